@@ -0,0 +1,53 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "JesterMassFragments.h"
+
+void FJesterMassFloatAggregator::Add(FName Reason, float Value)
+{
+	SetEntry(Values, Reason, Value);
+}
+
+void FJesterMassFloatAggregator::Multiply(FName Reason, float Value)
+{
+	SetEntry(Multipliers, Reason, Value);
+}
+
+void FJesterMassFloatAggregator::Remove(FName Reason)
+{
+	const auto HasReason = [Reason](const FJesterMassAggregatorEntry& Entry) { return Entry.Reason == Reason; };
+	if (Values.RemoveAllSwap(HasReason) > 0 || Multipliers.RemoveAllSwap(HasReason) > 0)
+	{
+		bDirty = true;
+	}
+}
+
+void FJesterMassFloatAggregator::UpdateTotal()
+{
+	float Sum = DefaultValue;
+	for (const FJesterMassAggregatorEntry& Entry : Values)
+	{
+		Sum += Entry.Value;
+	}
+
+	float Product = 1.0f;
+	for (const FJesterMassAggregatorEntry& Entry : Multipliers)
+	{
+		Product *= Entry.Value;
+	}
+
+	Total = Sum * Product;
+	bDirty = false;
+}
+
+void FJesterMassFloatAggregator::SetEntry(TArray<FJesterMassAggregatorEntry>& Entries, FName Reason, float Value)
+{
+	if (FJesterMassAggregatorEntry* Entry = Entries.FindByPredicate([Reason](const FJesterMassAggregatorEntry& Entry) { return Entry.Reason == Reason; }))
+	{
+		Entry->Value = Value;
+	}
+	else
+	{
+		Entries.Add({ Reason, Value });
+	}
+	bDirty = true;
+}
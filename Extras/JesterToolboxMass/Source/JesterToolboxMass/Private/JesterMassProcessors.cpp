@@ -0,0 +1,158 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "JesterMassProcessors.h"
+
+#include "Engine/World.h"
+#include "JesterMassCapability.h"
+#include "JesterMassFragments.h"
+#include "JesterToolboxStats.h"
+#include "JesterToolboxTrace.h"
+#include "MassExecutionContext.h"
+#include "UObject/UObjectIterator.h"
+
+UJesterMassCapabilityProcessor::UJesterMassCapabilityProcessor()
+{
+	bAutoRegisterWithProcessingPhases = true;
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+	ProcessingPhase = EMassProcessingPhase::PrePhysics;
+	// Capabilities are free to touch the world in their events
+	bRequiresGameThreadExecution = true;
+}
+
+void UJesterMassCapabilityProcessor::ConfigureQueries()
+{
+	StateQuery.AddRequirement<FJesterMassCapabilityFragment>(EMassFragmentAccess::ReadWrite);
+	StateQuery.AddConstSharedRequirement<FJesterMassCapabilitySheetFragment>();
+	StateQuery.RegisterWithProcessor(*this);
+
+	TArray<const UJesterMassCapability*> Capabilities;
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		if (It->IsChildOf(UJesterMassCapability::StaticClass()) && !It->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists))
+		{
+			Capabilities.Add(It->GetDefaultObject<UJesterMassCapability>());
+		}
+	}
+
+	// Sized up front, the processor keeps pointers to the registered queries
+	CapabilityQueries.SetNum(Capabilities.Num());
+	for (int32 i = 0; i < Capabilities.Num(); ++i)
+	{
+		FCapabilityQuery& CapabilityQuery = CapabilityQueries[i];
+		CapabilityQuery.Capability = Capabilities[i];
+		CapabilityQuery.Query.AddRequirement<FJesterMassCapabilityFragment>(EMassFragmentAccess::ReadWrite);
+		CapabilityQuery.Query.AddRequirement<FJesterMassPreventedCapabilitiesFragment>(EMassFragmentAccess::ReadOnly, EMassFragmentPresence::Optional);
+		CapabilityQuery.Query.AddConstSharedRequirement<FJesterMassCapabilitySheetFragment>();
+		// Let the capability add the fragments it works with
+		CapabilityQuery.Capability->ConfigureQuery(CapabilityQuery.Query);
+		CapabilityQuery.Query.RegisterWithProcessor(*this);
+	}
+}
+
+void UJesterMassCapabilityProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	JESTER_TRACE_SCOPE("Jester::MassCapabilityProcessor");
+	const float DeltaTime = Context.GetDeltaTimeSeconds();
+	const float Now = EntityManager.GetWorld()->GetTimeSeconds();
+
+	StateQuery.ForEachEntityChunk(EntityManager, Context, [](FMassExecutionContext& ChunkContext)
+	{
+		const FJesterMassCapabilitySheetFragment& Sheet = ChunkContext.GetConstSharedFragment<FJesterMassCapabilitySheetFragment>();
+		for (FJesterMassCapabilityFragment& State : ChunkContext.GetMutableFragmentView<FJesterMassCapabilityFragment>())
+		{
+			if (State.EnableStartTimes.Num() != Sheet.Capabilities.Num())
+			{
+				State.EnableStartTimes.Init(-1.0f, Sheet.Capabilities.Num());
+				State.EnabledMask = 0;
+			}
+		}
+
+		JESTER_STAT_ADD(CapabilityUpdates, ChunkContext.GetNumEntities());
+	});
+
+	for (FCapabilityQuery& CapabilityQuery : CapabilityQueries)
+	{
+		const UJesterMassCapability* Capability = CapabilityQuery.Capability;
+		CapabilityQuery.Query.ForEachEntityChunk(EntityManager, Context, [Capability, DeltaTime, Now](FMassExecutionContext& ChunkContext)
+		{
+			const FJesterMassCapabilitySheetFragment& Sheet = ChunkContext.GetConstSharedFragment<FJesterMassCapabilitySheetFragment>();
+			const int32 CapabilityIndex = Sheet.Capabilities.IndexOfByKey(Capability);
+			if (CapabilityIndex == INDEX_NONE)
+			{
+				return;
+			}
+
+			const TArrayView<FJesterMassCapabilityFragment> CapabilityStates = ChunkContext.GetMutableFragmentView<FJesterMassCapabilityFragment>();
+			const TConstArrayView<FJesterMassPreventedCapabilitiesFragment> PreventedCapabilities = ChunkContext.GetFragmentView<FJesterMassPreventedCapabilitiesFragment>();
+			const uint64 CapabilityBit = uint64(1) << CapabilityIndex;
+
+			for (int32 EntityIndex = 0; EntityIndex < ChunkContext.GetNumEntities(); ++EntityIndex)
+			{
+				FJesterMassCapabilityFragment& State = CapabilityStates[EntityIndex];
+				float& EnableStartTime = State.EnableStartTimes[CapabilityIndex];
+				FJesterMassCapabilityContext CapabilityContext{ ChunkContext, EntityIndex, DeltaTime, EnableStartTime >= 0.0f ? Now - EnableStartTime : -1.0f };
+
+				if (State.IsEnabled(CapabilityIndex))
+				{
+					if (Capability->ShouldDisable(CapabilityContext))
+					{
+						State.EnabledMask &= ~CapabilityBit;
+						EnableStartTime = -1.0f;
+						Capability->OnDisableCapability(CapabilityContext);
+						continue;
+					}
+				}
+				else
+				{
+					const bool bPrevented = PreventedCapabilities.Num() > 0 && PreventedCapabilities[EntityIndex].PreventedTags.HasAny(Capability->CapabilityTags);
+					if (bPrevented || !Capability->ShouldEnable(CapabilityContext))
+					{
+						continue;
+					}
+
+					State.EnabledMask |= CapabilityBit;
+					EnableStartTime = Now;
+					CapabilityContext.TimeEnabled = 0.0f;
+					Capability->OnEnableCapability(CapabilityContext);
+				}
+
+				Capability->OnTickActive(CapabilityContext);
+			}
+		});
+	}
+}
+
+UJesterMassFloatAggregatorProcessor::UJesterMassFloatAggregatorProcessor()
+{
+	bAutoRegisterWithProcessingPhases = true;
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+	ProcessingPhase = EMassProcessingPhase::PrePhysics;
+	bRequiresGameThreadExecution = false;
+}
+
+void UJesterMassFloatAggregatorProcessor::ConfigureQueries()
+{
+	EntityQuery.AddRequirement<FJesterMassFloatAggregatorsFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.RegisterWithProcessor(*this);
+}
+
+void UJesterMassFloatAggregatorProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	JESTER_TRACE_SCOPE("Jester::MassFloatAggregatorProcessor");
+	EntityQuery.ForEachEntityChunk(EntityManager, Context, [](FMassExecutionContext& ChunkContext)
+	{
+		int32 NumUpdates = 0;
+		for (FJesterMassFloatAggregatorsFragment& Fragment : ChunkContext.GetMutableFragmentView<FJesterMassFloatAggregatorsFragment>())
+		{
+			for (FJesterMassFloatAggregator& Aggregator : Fragment.Aggregators)
+			{
+				if (Aggregator.IsDirty())
+				{
+					Aggregator.UpdateTotal();
+					NumUpdates++;
+				}
+			}
+		}
+		JESTER_STAT_ADD(AggregatorUpdates, NumUpdates);
+	});
+}
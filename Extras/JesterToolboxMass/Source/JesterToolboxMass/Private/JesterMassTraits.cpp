@@ -0,0 +1,144 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "JesterMassTraits.h"
+
+#include "Engine/DataAsset.h"
+#include "JesterMassCapability.h"
+#include "JesterToolboxMass.h"
+#include "MassEntityTemplateRegistry.h"
+#include "MassEntityUtils.h"
+#include "UObject/UObjectIterator.h"
+
+namespace
+{
+	// Mass capabilities by the script capability they stand for
+	TMap<FSoftClassPath, UJesterMassCapability*> GetMassCapabilitiesByScriptCapability()
+	{
+		TMap<FSoftClassPath, UJesterMassCapability*> MassCapabilities;
+		for (TObjectIterator<UClass> It; It; ++It)
+		{
+			if (!It->IsChildOf(UJesterMassCapability::StaticClass()) || It->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists))
+			{
+				continue;
+			}
+
+			UJesterMassCapability* MassCapability = It->GetDefaultObject<UJesterMassCapability>();
+			if (MassCapability->ScriptCapability.IsNull())
+			{
+				continue;
+			}
+
+			if (const UJesterMassCapability* const* Existing = MassCapabilities.Find(MassCapability->ScriptCapability))
+			{
+				UE_LOG(LogJesterMass, Error, TEXT("%s and %s are both the Mass version of %s, %s is ignored"),
+					*(*Existing)->GetClass()->GetName(), *It->GetName(), *MassCapability->ScriptCapability.ToString(), *It->GetName());
+				continue;
+			}
+			MassCapabilities.Add(MassCapability->ScriptCapability, MassCapability);
+		}
+		return MassCapabilities;
+	}
+
+	// A script capability without its own Mass version uses the one of its closest parent
+	UJesterMassCapability* FindMassCapability(const TMap<FSoftClassPath, UJesterMassCapability*>& MassCapabilities, const UClass* ScriptCapabilityClass)
+	{
+		for (const UClass* Class = ScriptCapabilityClass; Class != nullptr; Class = Class->GetSuperClass())
+		{
+			if (UJesterMassCapability* const* MassCapability = MassCapabilities.Find(FSoftClassPath(Class)))
+			{
+				return *MassCapability;
+			}
+		}
+		return nullptr;
+	}
+}
+
+void UJesterMassCapabilityTrait::BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const
+{
+	FMassEntityManager& EntityManager = UE::Mass::Utils::GetEntityManagerChecked(World);
+
+	FJesterMassCapabilitySheetFragment Sheet;
+	GatherCapabilities(Sheet.Capabilities);
+	BuildContext.AddConstSharedFragment(EntityManager.GetOrCreateConstSharedFragment(Sheet));
+
+	FJesterMassCapabilityFragment& CapabilityFragment = BuildContext.AddFragment_GetRef<FJesterMassCapabilityFragment>();
+	CapabilityFragment.EnableStartTimes.Init(-1.0f, Sheet.Capabilities.Num());
+
+	BuildContext.AddFragment_GetRef<FJesterMassPreventedCapabilitiesFragment>().PreventedTags = InitiallyPreventedTags;
+}
+
+void UJesterMassCapabilityTrait::GatherCapabilities(TArray<UJesterMassCapability*>& OutCapabilities) const
+{
+	const TMap<FSoftClassPath, UJesterMassCapability*> MassCapabilities = GetMassCapabilitiesByScriptCapability();
+	for (const UDataAsset* Sheet : CapabilitySheets)
+	{
+		if (Sheet == nullptr)
+		{
+			continue;
+		}
+
+		// The sheets are script assets, read their Capabilities array through reflection
+		const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Sheet->GetClass()->FindPropertyByName(TEXT("Capabilities")));
+		const FClassProperty* ClassProperty = ArrayProperty != nullptr ? CastField<FClassProperty>(ArrayProperty->Inner) : nullptr;
+		if (ClassProperty == nullptr)
+		{
+			UE_LOG(LogJesterMass, Error, TEXT("%s isn't a capability sheet"), *Sheet->GetName());
+			continue;
+		}
+
+		auto AddScriptCapability = [this, &MassCapabilities, &OutCapabilities](const UClass* ScriptCapabilityClass)
+		{
+			if (ScriptCapabilityClass == nullptr)
+			{
+				return;
+			}
+
+			if (UJesterMassCapability* MassCapability = FindMassCapability(MassCapabilities, ScriptCapabilityClass))
+			{
+				OutCapabilities.AddUnique(MassCapability);
+			}
+			else
+			{
+				UE_LOG(LogJesterMass, Verbose, TEXT("%s has no Mass version, skipped for %s"), *ScriptCapabilityClass->GetName(), *GetName());
+			}
+		};
+
+		FScriptArrayHelper ArrayHelper(ArrayProperty, ArrayProperty->ContainerPtrToValuePtr<void>(Sheet));
+		for (int32 i = 0; i < ArrayHelper.Num(); ++i)
+		{
+			AddScriptCapability(Cast<UClass>(ClassProperty->GetObjectPropertyValue(ArrayHelper.GetRawPtr(i))));
+		}
+
+		// Soft capabilities are loaded here, templates are built once per config rather than per spawn
+		const FArrayProperty* SoftArrayProperty = CastField<FArrayProperty>(Sheet->GetClass()->FindPropertyByName(TEXT("SoftCapabilities")));
+		if (SoftArrayProperty != nullptr && SoftArrayProperty->Inner->IsA<FSoftClassProperty>())
+		{
+			FScriptArrayHelper SoftArrayHelper(SoftArrayProperty, SoftArrayProperty->ContainerPtrToValuePtr<void>(Sheet));
+			for (int32 i = 0; i < SoftArrayHelper.Num(); ++i)
+			{
+				const FSoftObjectPtr& SoftClass = *reinterpret_cast<const FSoftObjectPtr*>(SoftArrayHelper.GetRawPtr(i));
+				AddScriptCapability(Cast<UClass>(SoftClass.LoadSynchronous()));
+			}
+		}
+	}
+
+	for (const TSubclassOf<UJesterMassCapability>& CapabilityClass : Capabilities)
+	{
+		if (CapabilityClass != nullptr)
+		{
+			OutCapabilities.AddUnique(CapabilityClass->GetDefaultObject<UJesterMassCapability>());
+		}
+	}
+
+	if (OutCapabilities.Num() > FJesterMassCapabilitySheetFragment::MaxCapabilities)
+	{
+		UE_LOG(LogJesterMass, Error, TEXT("%s has %d capabilities, only the first %d are used"),
+			*GetName(), OutCapabilities.Num(), FJesterMassCapabilitySheetFragment::MaxCapabilities);
+		OutCapabilities.SetNum(FJesterMassCapabilitySheetFragment::MaxCapabilities);
+	}
+}
+
+void UJesterMassFloatAggregatorTrait::BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const
+{
+	BuildContext.AddFragment_GetRef<FJesterMassFloatAggregatorsFragment>().Aggregators = Aggregators;
+}
@@ -0,0 +1,19 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "JesterToolboxMass.h"
+
+DEFINE_LOG_CATEGORY(LogJesterMass);
+
+#define LOCTEXT_NAMESPACE "FJesterToolboxMassModule"
+
+void FJesterToolboxMassModule::StartupModule()
+{
+}
+
+void FJesterToolboxMassModule::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+
+IMPLEMENT_MODULE(FJesterToolboxMassModule, JesterToolboxMass)
@@ -0,0 +1,69 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "MassExecutionContext.h"
+#include "JesterMassCapability.generated.h"
+
+struct FMassEntityQuery;
+
+/** What a capability gets to look at for one entity of the chunk being processed */
+struct FJesterMassCapabilityContext
+{
+	FMassExecutionContext& ExecutionContext;
+	int32 EntityIndex = 0;
+	float DeltaTime = 0.0f;
+	// Seconds since the capability got enabled, -1 when it isn't
+	float TimeEnabled = -1.0f;
+
+	template<typename TFragment>
+	const TFragment& GetFragment() const
+	{
+		return ExecutionContext.GetFragmentView<TFragment>()[EntityIndex];
+	}
+
+	template<typename TFragment>
+	TFragment& GetMutableFragment() const
+	{
+		return ExecutionContext.GetMutableFragmentView<TFragment>()[EntityIndex];
+	}
+
+	FMassEntityHandle GetEntity() const
+	{
+		return ExecutionContext.GetEntity(EntityIndex);
+	}
+};
+
+/**
+ * Capability for Mass entities, the crowd counterpart of UCapability_AS. Stateless: only the class default object is
+ * used and it's shared by every entity, the per entity state lives in FJesterMassCapabilityFragment and the fragments
+ * the capability asks for in ConfigureQuery.
+ * A Mass capability names the script capability it stands for in ScriptCapability, so the same capability sheets can
+ * feed both actors and entities.
+ */
+UCLASS(Abstract)
+class JESTERTOOLBOXMASS_API UJesterMassCapability : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	// Add the fragments ShouldEnable, ShouldDisable and the events read or write, the capability only runs on entities that match
+	virtual void ConfigureQuery(FMassEntityQuery& Query) const {}
+
+	virtual bool ShouldEnable(const FJesterMassCapabilityContext& Context) const { return true; }
+	virtual bool ShouldDisable(const FJesterMassCapabilityContext& Context) const { return false; }
+
+	virtual void OnEnableCapability(const FJesterMassCapabilityContext& Context) const {}
+	virtual void OnDisableCapability(const FJesterMassCapabilityContext& Context) const {}
+	virtual void OnTickActive(const FJesterMassCapabilityContext& Context) const {}
+
+	// Same role as UCapability_AS::CapabilityTags, checked against FJesterMassPreventedCapabilitiesFragment
+	UPROPERTY(EditDefaultsOnly, Category = "Capability")
+	FGameplayTagContainer CapabilityTags;
+
+	// Script capability this is the Mass version of, also used for its script subclasses that don't have their own
+	UPROPERTY(EditDefaultsOnly, Category = "Capability")
+	FSoftClassPath ScriptCapability;
+};
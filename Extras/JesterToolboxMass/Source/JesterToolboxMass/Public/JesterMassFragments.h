@@ -0,0 +1,110 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "MassEntityTypes.h"
+#include "JesterMassFragments.generated.h"
+
+class UJesterMassCapability;
+
+USTRUCT()
+struct FJesterMassAggregatorEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere)
+	FName Reason;
+
+	UPROPERTY(VisibleAnywhere)
+	float Value = 0.0f;
+};
+
+/**
+ * Native FFloatAggregator for entities: (DefaultValue + Sum(Values)) * Product(Multipliers).
+ * Reasons are FNames instead of strings and the total is cached until the next change.
+ */
+USTRUCT()
+struct JESTERTOOLBOXMASS_API FJesterMassFloatAggregator
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere)
+	FName Name;
+
+	UPROPERTY(EditAnywhere)
+	float DefaultValue = 0.0f;
+
+	void Add(FName Reason, float Value);
+	void Multiply(FName Reason, float Value);
+	void Remove(FName Reason);
+
+	// Cached total, refreshed by UJesterMassFloatAggregatorProcessor or UpdateTotal
+	float GetTotal() const { return Total; }
+	bool IsDirty() const { return bDirty; }
+	void UpdateTotal();
+
+private:
+	static void SetEntry(TArray<FJesterMassAggregatorEntry>& Entries, FName Reason, float Value);
+
+	UPROPERTY(VisibleAnywhere)
+	TArray<FJesterMassAggregatorEntry> Values;
+
+	UPROPERTY(VisibleAnywhere)
+	TArray<FJesterMassAggregatorEntry> Multipliers;
+
+	float Total = 0.0f;
+	bool bDirty = true;
+};
+
+USTRUCT()
+struct JESTERTOOLBOXMASS_API FJesterMassFloatAggregatorsFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere)
+	TArray<FJesterMassFloatAggregator> Aggregators;
+
+	FJesterMassFloatAggregator* Find(FName Name)
+	{
+		return Aggregators.FindByPredicate([Name](const FJesterMassFloatAggregator& Aggregator) { return Aggregator.Name == Name; });
+	}
+};
+
+/** Per entity state of the capabilities listed in the entity's FJesterMassCapabilitySheetFragment */
+USTRUCT()
+struct JESTERTOOLBOXMASS_API FJesterMassCapabilityFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	// Bit per capability of the sheet, FJesterMassCapabilitySheetFragment::MaxCapabilities at most
+	uint64 EnabledMask = 0;
+
+	// World time at which each capability got enabled, same order as the sheet
+	TArray<float, TInlineAllocator<8>> EnableStartTimes;
+
+	bool IsEnabled(int32 CapabilityIndex) const { return (EnabledMask & (uint64(1) << CapabilityIndex)) != 0; }
+};
+
+/** Capability tags that can't be enabled on this entity, the Mass counterpart of PreventedCapabilities */
+USTRUCT()
+struct JESTERTOOLBOXMASS_API FJesterMassPreventedCapabilitiesFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere)
+	FGameplayTagContainer PreventedTags;
+};
+
+/** Capabilities shared by every entity built from the same trait, evaluated in order like the root parallel node */
+USTRUCT()
+struct JESTERTOOLBOXMASS_API FJesterMassCapabilitySheetFragment : public FMassConstSharedFragment
+{
+	GENERATED_BODY()
+
+	static constexpr int32 MaxCapabilities = 64;
+
+	UPROPERTY()
+	TArray<UJesterMassCapability*> Capabilities;
+};
@@ -0,0 +1,57 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityQuery.h"
+#include "MassProcessor.h"
+#include "JesterMassProcessors.generated.h"
+
+class UJesterMassCapability;
+
+/**
+ * Updates the capabilities of every entity chunk by chunk: disables the enabled ones that should stop, enables the
+ * others that can start and aren't prevented, then ticks the enabled ones. Same rules as the actor leaf nodes.
+ * Each capability class has its own query built from its ConfigureQuery, so a capability only runs on the entities
+ * that have the fragments it asked for. Capabilities are updated class by class rather than in sheet order.
+ */
+UCLASS()
+class JESTERTOOLBOXMASS_API UJesterMassCapabilityProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UJesterMassCapabilityProcessor();
+
+protected:
+	virtual void ConfigureQueries() override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	struct FCapabilityQuery
+	{
+		const UJesterMassCapability* Capability = nullptr;
+		FMassEntityQuery Query;
+	};
+
+	// Sizes the per entity state to the sheet, shared by every capability query
+	FMassEntityQuery StateQuery;
+	TArray<FCapabilityQuery> CapabilityQueries;
+};
+
+/** Refreshes the cached totals of the aggregators that changed since the last frame */
+UCLASS()
+class JESTERTOOLBOXMASS_API UJesterMassFloatAggregatorProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UJesterMassFloatAggregatorProcessor();
+
+protected:
+	virtual void ConfigureQueries() override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery EntityQuery;
+};
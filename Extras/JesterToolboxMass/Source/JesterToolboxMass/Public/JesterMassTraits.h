@@ -0,0 +1,51 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JesterMassFragments.h"
+#include "MassEntityTraitBase.h"
+#include "JesterMassTraits.generated.h"
+
+class UDataAsset;
+class UJesterMassCapability;
+
+/**
+ * Gives entities the capabilities of capability sheets (the same UCapabilitySheet_AS assets the actors use) and of
+ * the Capabilities list. Script capabilities that no UJesterMassCapability::ScriptCapability points to are skipped.
+ */
+UCLASS(meta = (DisplayName = "Jester Capabilities"))
+class JESTERTOOLBOXMASS_API UJesterMassCapabilityTrait : public UMassEntityTraitBase
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, Category = "Capabilities")
+	TArray<UDataAsset*> CapabilitySheets;
+
+	UPROPERTY(EditAnywhere, Category = "Capabilities")
+	TArray<TSubclassOf<UJesterMassCapability>> Capabilities;
+
+	UPROPERTY(EditAnywhere, Category = "Capabilities")
+	FGameplayTagContainer InitiallyPreventedTags;
+
+protected:
+	virtual void BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const override;
+
+private:
+	void GatherCapabilities(TArray<UJesterMassCapability*>& OutCapabilities) const;
+};
+
+UCLASS(meta = (DisplayName = "Jester Float Aggregators"))
+class JESTERTOOLBOXMASS_API UJesterMassFloatAggregatorTrait : public UMassEntityTraitBase
+{
+	GENERATED_BODY()
+
+public:
+	// Name and default value of every aggregator the entities start with
+	UPROPERTY(EditAnywhere, Category = "Aggregators")
+	TArray<FJesterMassFloatAggregator> Aggregators;
+
+protected:
+	virtual void BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const override;
+};
@@ -0,0 +1,82 @@
+#if EDITOR
+/**
+ * Aggregator benchmarks, run by the JesterBenchmark commandlet
+ */
+class UFloatAggregatorBenchmark_AS : UJesterScriptBenchmark
+{
+	default BenchmarkName = "Aggregators.FloatAggregator.AddAndGetTotal";
+	default CallsPerSample = 100;
+	default AllocationBudget = 0;
+
+	FFloatAggregator Aggregator;
+
+	UFUNCTION(BlueprintOverride)
+	void Setup()
+	{
+		Aggregator.DefaultValue = 100.0f;
+		for (int i = 0; i < 8; i++)
+		{
+			Aggregator.Add(f"Value{i}", i);
+			Aggregator.Multiply(f"Multiplier{i}", 1.0f + i * 0.1f);
+		}
+	}
+
+	UFUNCTION(BlueprintOverride)
+	void RunSample()
+	{
+		for (int i = 0; i < CallsPerSample; i++)
+		{
+			Aggregator.Add("Value7", i);
+			Aggregator.GetTotal();
+		}
+	}
+}
+
+class UBoolAggregatorBenchmark_AS : UJesterScriptBenchmark
+{
+	default BenchmarkName = "Aggregators.BoolAggregator.AddAndAnd";
+	default CallsPerSample = 100;
+	default AllocationBudget = 0;
+
+	FBoolAggregator Aggregator;
+
+	UFUNCTION(BlueprintOverride)
+	void Setup()
+	{
+		for (int i = 0; i < 8; i++)
+		{
+			Aggregator.Add(f"Reason{i}", true);
+		}
+	}
+
+	UFUNCTION(BlueprintOverride)
+	void RunSample()
+	{
+		for (int i = 0; i < CallsPerSample; i++)
+		{
+			Aggregator.Add("Reason7", i % 2 == 0);
+			Aggregator.And();
+		}
+	}
+}
+
+class UCircularFloatHistoryBenchmark_AS : UJesterScriptBenchmark
+{
+	default BenchmarkName = "Utils.CircularFloatHistory.AddAndGetAll";
+	default CallsPerSample = 100;
+	// GetAll returns a copy
+	default AllocationBudget = 1;
+
+	FCircularFloatHistory History = FCircularFloatHistory(120, false);
+
+	UFUNCTION(BlueprintOverride)
+	void RunSample()
+	{
+		for (int i = 0; i < CallsPerSample; i++)
+		{
+			History.Add(i);
+			History.GetAll();
+		}
+	}
+}
+#endif
@@ -0,0 +1,114 @@
+#if EDITOR
+/**
+ * Capability tree benchmarks, run by the JesterBenchmark commandlet
+ */
+class UBenchmarkAlwaysCapability_AS : UCapability_AS
+{
+}
+
+// Flips between enabled and disabled every few updates so the tree keeps changing state
+class UBenchmarkToggleCapability_AS : UCapability_AS
+{
+	private int Counter = 0;
+
+	UFUNCTION(BlueprintOverride)
+	bool ShouldEnable(UCapabilitySystemComponent_AS CapabilitySystem, ACharacter Character)
+	{
+		Counter++;
+		return Counter % 2 == 0;
+	}
+
+	UFUNCTION(BlueprintOverride)
+	bool ShouldDisable(UCapabilitySystemComponent_AS CapabilitySystem, ACharacter Character)
+	{
+		Counter++;
+		return Counter % 3 == 0;
+	}
+}
+
+class UBenchmarkCapabilitySystemComponent_AS : UCapabilitySystemComponent_AS
+{
+	UFUNCTION(BlueprintOverride)
+	void BeginPlay()
+	{
+		for (int i = 0; i < 4; i++)
+		{
+			Capabilities.Add(UBenchmarkAlwaysCapability_AS);
+			Capabilities.Add(UBenchmarkToggleCapability_AS);
+		}
+		Super::BeginPlay();
+	}
+}
+
+class ABenchmarkCapabilityActor_AS : AActor
+{
+	UPROPERTY(DefaultComponent)
+	UBenchmarkCapabilitySystemComponent_AS CapabilitySystem;
+}
+
+// Micro benchmark: a single capability tree update
+class UCapabilityTreeUpdateBenchmark_AS : UJesterScriptBenchmark
+{
+	default BenchmarkName = "Capability.UpdateCapabilityNodes.8Capabilities";
+	default CallsPerSample = 100;
+	// The tree update itself shouldn't allocate, this leaves room for the execution result array
+	default AllocationBudget = 2;
+
+	ABenchmarkCapabilityActor_AS Actor;
+
+	UFUNCTION(BlueprintOverride)
+	void Setup()
+	{
+		Actor = Cast<ABenchmarkCapabilityActor_AS>(SpawnActor(ABenchmarkCapabilityActor_AS, FVector::ZeroVector));
+		Actor.SetActorTickEnabled(false);
+		Actor.CapabilitySystem.SetComponentTickEnabled(false);
+	}
+
+	UFUNCTION(BlueprintOverride)
+	void RunSample()
+	{
+		for (int i = 0; i < CallsPerSample; i++)
+		{
+			Actor.CapabilitySystem.UpdateCapabilityNodes(1.0f / 60.0f);
+		}
+	}
+
+	UFUNCTION(BlueprintOverride)
+	void Teardown()
+	{
+		Actor.DestroyActor();
+	}
+}
+
+// Macro benchmark: a full world frame with a crowd of capability actors
+class UCapabilityCrowdFrameBenchmark_AS : UJesterScriptBenchmark
+{
+	default BenchmarkName = "Capability.WorldTick.200Actors";
+	default bTickWorld = true;
+	// Only the capability ticks are counted, not the rest of the engine frame
+	default bToolboxAllocationsOnly = true;
+	// Per frame, two per actor is the same margin as the single tree update
+	default AllocationBudget = 400;
+
+	TArray<ABenchmarkCapabilityActor_AS> Actors;
+
+	UFUNCTION(BlueprintOverride)
+	void Setup()
+	{
+		for (int i = 0; i < 200; i++)
+		{
+			Actors.Add(Cast<ABenchmarkCapabilityActor_AS>(SpawnActor(ABenchmarkCapabilityActor_AS, FVector(i * 100.0f, 0, 0))));
+		}
+	}
+
+	UFUNCTION(BlueprintOverride)
+	void Teardown()
+	{
+		for (ABenchmarkCapabilityActor_AS Actor : Actors)
+		{
+			Actor.DestroyActor();
+		}
+		Actors.Empty();
+	}
+}
+#endif
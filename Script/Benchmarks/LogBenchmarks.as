@@ -0,0 +1,20 @@
+#if EDITOR
+/**
+ * Log helper benchmarks, run by the JesterBenchmark commandlet
+ */
+class UGetASCurrentFunctionNameBenchmark_AS : UJesterScriptBenchmark
+{
+	default BenchmarkName = "Log.GetASCurrentFunctionName";
+	default CallsPerSample = 100;
+	default AllocationBudget = 2;
+
+	UFUNCTION(BlueprintOverride)
+	void RunSample()
+	{
+		for (int i = 0; i < CallsPerSample; i++)
+		{
+			Jester::GetASCurrentFunctionName();
+		}
+	}
+}
+#endif
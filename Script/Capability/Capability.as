@@ -36,7 +36,7 @@
  * ```
  */
 UCLASS(Abstract)
-class UCapability_AS : UObject
+class UCapability_AS : UObject, UJesterPoolable
 {
 	/**
 	 * Tags that identify this capability type - used for prevention and categorization
@@ -213,6 +213,16 @@ class UCapability_AS : UObject
 		return false;
 	}
 
+	/**
+	 * Called when the capability goes back to the object pool with its tree, already disabled
+	 * The pool resets every property to the class defaults afterwards, override this only to release
+	 * things held outside of the capability (timers, bound delegates) and call Super::OnReturnedToPool()
+	 */
+	UFUNCTION(BlueprintOverride)
+	void OnReturnedToPool()
+	{
+	}
+
 	/**
 	 * Creates a capability node wrapper for this capability
 	 * Used internally by the capability system to integrate with capability trees
@@ -221,7 +231,7 @@ class UCapability_AS : UObject
 	 */
 	UCapabilityNode_AS GenerateCompoundNode()
 	{
-		ULeafNode_AS LeafNode = ULeafNode_AS();
+		ULeafNode_AS LeafNode = Cast<ULeafNode_AS>(JesterCapability::AcquireCapabilityObject(GetOuter(), ULeafNode_AS));
 		LeafNode.Init(GetClass(), this);
 		return LeafNode;
 	}
@@ -233,11 +243,14 @@ class UCapability_AS : UObject
 	 */
 	void ShowImGui()
 	{
-		ImGui::Text(f"Class: {GetClass().GetName()}");
-		ImGui::Text(f"Enabled: {bIsEnabled}");
+		ImGui::ValueText("Class", GetClass());
+		ImGui::ValueText("Enabled", bIsEnabled);
 		if (bIsEnabled)
 		{
-			ImGui::Text(f"Time Enabled: {GetTimeEnabled():.2f}s");
+			JesterText::Begin("Time Enabled: ");
+			JesterText::AppendFloat(GetTimeEnabled(), 2);
+			JesterText::Append("s");
+			ImGui::Text(JesterText::Get());
 		}
 
 		if (CapabilityTags.Num() > 0)
@@ -246,7 +259,9 @@ class UCapability_AS : UObject
 			ImGui::Indent();
 			for (FGameplayTag Tag : CapabilityTags.GameplayTags)
 			{
-				ImGui::Text(f"  - {Tag.ToString()}");
+				JesterText::Begin("  - ");
+				JesterText::AppendTag(Tag);
+				ImGui::Text(JesterText::Get());
 			}
 			ImGui::Unindent();
 		}
@@ -57,6 +57,18 @@ class UCapabilityNode_AS : UObject
 
     }
 
+    /**
+     * Hands this node back to the object pool so the next tree can reuse it
+     * Composite nodes release their children first, leaf nodes their capability
+     *
+     * @param Pool The object pool of the world this tree lives in
+     */
+    void ReleaseToPool(UJesterObjectPoolSubsystem Pool)
+    {
+        ParentNode = nullptr;
+        Pool.Release(this);
+    }
+
     /**
      * Debug method for displaying node information in ImGui
      * Override to show node-specific debug information
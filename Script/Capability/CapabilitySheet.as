@@ -2,4 +2,11 @@ class UCapabilitySheet_AS : UDataAsset
 {
     UPROPERTY(EditAnywhere)
     TArray<TSubclassOf<UCapability_AS>> Capabilities;
-}
\ No newline at end of file
+
+    /**
+     * Capabilities that don't load with the sheet. The capability system streams them in, in one batch with
+     * the other soft capabilities of its owner, and builds its tree once they are resident
+     */
+    UPROPERTY(EditAnywhere)
+    TArray<TSoftClassPtr<UCapability_AS>> SoftCapabilities;
+}
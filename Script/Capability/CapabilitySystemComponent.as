@@ -32,6 +32,16 @@ class UCapabilitySystemComponent_AS : UActorComponent
 	UPROPERTY()
 	TArray<UCapabilitySheet_AS> CapabilitySheets;
 
+	/**
+	 * Capability classes loaded asynchronously, together with the SoftCapabilities of the sheets
+	 * The capability tree is built once all of them are resident
+	 */
+	UPROPERTY()
+	TArray<TSoftClassPtr<UCapability_AS>> SoftCapabilities;
+
+	/** Pending load of the soft capabilities, started by PreloadCapabilities or BeginPlay */
+	private UJesterAwaitable SoftCapabilitiesLoad;
+
 	/**
 	 * Root node of the capability tree - runs all child capabilities in parallel
 	 * This is the top-level container for all capability logic
@@ -53,6 +63,9 @@ class UCapabilitySystemComponent_AS : UActorComponent
 	UPROPERTY(VisibleInstanceOnly)
 	private FGameplayTagAggregator PreventedCapabilities;
 
+	/** Number of capabilities created in BeginPlay, reported to the JesterToolbox stats */
+	private int NumCreatedCapabilities = 0;
+
 	/**
 	 * Gets the prevented capabilities aggregator for external modification
 	 * @return Reference to the prevented capabilities aggregator
@@ -63,41 +76,156 @@ class UCapabilitySystemComponent_AS : UActorComponent
 		return PreventedCapabilities;
 	}
 
+	/**
+	 * Starts streaming in the soft capabilities, call it right after a deferred spawn to overlap the load with the
+	 * rest of the spawn. BeginPlay does it otherwise
+	 * @return Awaitable completing once every soft capability is resident
+	 */
+	UFUNCTION()
+	UJesterAwaitable PreloadCapabilities()
+	{
+		if (SoftCapabilitiesLoad == nullptr)
+		{
+			TArray<FSoftObjectPath> Paths;
+			for (TSoftClassPtr<UCapability_AS> EachCapability : SoftCapabilities)
+			{
+				Paths.Add(EachCapability.ToSoftObjectPath());
+			}
+			for (UCapabilitySheet_AS EachSheet : CapabilitySheets)
+			{
+				if (EachSheet == nullptr)
+					continue;
+
+				for (TSoftClassPtr<UCapability_AS> EachCapability : EachSheet.SoftCapabilities)
+				{
+					Paths.Add(EachCapability.ToSoftObjectPath());
+				}
+			}
+			SoftCapabilitiesLoad = JesterAsync::LoadAssetBatch(Paths);
+		}
+		return SoftCapabilitiesLoad;
+	}
+
+	/** False until the soft capabilities are resident and the tree is built */
+	UFUNCTION(BlueprintPure)
+	bool IsCapabilityTreeBuilt() const
+	{
+		return RootCapabilityNode != nullptr;
+	}
+
 	UFUNCTION(BlueprintOverride)
 	void BeginPlay()
 	{
-		RootCapabilityNode = NewObject(this, UParallelSequence_AS);
+		// Completes right away when there are no soft capabilities or they are already loaded
+		PreloadCapabilities().Then(FJesterAwaitableContinuation(this, n"OnSoftCapabilitiesLoaded"));
+	}
+
+	UFUNCTION()
+	private void OnSoftCapabilitiesLoaded(UJesterAwaitable Awaitable)
+	{
+		SoftCapabilitiesLoad = nullptr;
+		RootCapabilityNode = Cast<UParallelSequence_AS>(JesterCapability::AcquireCapabilityObject(this, UParallelSequence_AS));
 		for (TSubclassOf<UCapability_AS> EachCapability : Capabilities)
 		{
-			UCapability_AS Capability = NewObject(this, EachCapability);
-			if (Capability != nullptr)
+			AddCapability(EachCapability);
+		}
+
+		for (UCapabilitySheet_AS EachSheet : CapabilitySheets)
+		{
+			if (EachSheet == nullptr)
+				continue;
+
+			for (TSubclassOf<UCapability_AS> EachCapability : EachSheet.Capabilities)
 			{
-				RootCapabilityNode.Do(Capability.GenerateCompoundNode());
+				AddCapability(EachCapability);
 			}
 		}
 
+		// Resident now, the tree holds the classes from here on
+		for (TSoftClassPtr<UCapability_AS> EachCapability : SoftCapabilities)
+		{
+			AddCapability(EachCapability.Get());
+		}
 		for (UCapabilitySheet_AS EachSheet : CapabilitySheets)
 		{
-			for (TSubclassOf<UCapability_AS> EachCapability : EachSheet.Capabilities)
+			if (EachSheet == nullptr)
+				continue;
+
+			for (TSoftClassPtr<UCapability_AS> EachCapability : EachSheet.SoftCapabilities)
 			{
-				UCapability_AS Capability = NewObject(this, EachCapability);
-				if (Capability != nullptr)
-				{
-					RootCapabilityNode.Do(Capability.GenerateCompoundNode());
-				}
+				AddCapability(EachCapability.Get());
 			}
 		}
+		JesterStats::ModifyCapabilityCount(NumCreatedCapabilities);
+	}
+
+	private void AddCapability(TSubclassOf<UCapability_AS> CapabilityClass)
+	{
+		if (CapabilityClass == nullptr)
+		{
+			return;
+		}
+
+		UCapability_AS Capability = Cast<UCapability_AS>(JesterCapability::AcquireCapabilityObject(this, CapabilityClass));
+		if (Capability != nullptr)
+		{
+			RootCapabilityNode.Do(Capability.GenerateCompoundNode());
+			NumCreatedCapabilities++;
+		}
+	}
+
+	UFUNCTION(BlueprintOverride)
+	void EndPlay(EEndPlayReason EndPlayReason)
+	{
+		JesterStats::ModifyCapabilityCount(-NumCreatedCapabilities);
+		NumCreatedCapabilities = 0;
+
+		// Still loading, the tree was never built
+		if (SoftCapabilitiesLoad != nullptr)
+		{
+			SoftCapabilitiesLoad.Cancel();
+			SoftCapabilitiesLoad = nullptr;
+		}
+
+		// Let the active capabilities run their cleanup (stop jumping...) before the tree goes away
+		for (UCapability_AS Capability : ActiveCapabilities)
+		{
+			if (Capability != nullptr && Capability.bIsEnabled)
+			{
+				Capability.DisableCapability();
+			}
+		}
+
+		// Hand the tree back to the pool so the next character (or this one on respawn) rebuilds it without allocating.
+		// The pool goes away with the world, no point in releasing on map changes.
+		if (EndPlayReason == EEndPlayReason::Destroyed || EndPlayReason == EEndPlayReason::RemovedFromWorld)
+		{
+			UJesterObjectPoolSubsystem Pool = UJesterObjectPoolSubsystem::Get();
+			if (Pool != nullptr && RootCapabilityNode != nullptr)
+			{
+				RootCapabilityNode.ReleaseToPool(Pool);
+			}
+		}
+		RootCapabilityNode = nullptr;
+		ActiveCapabilities.Empty();
 	}
 
 	UFUNCTION(BlueprintOverride)
 	void Tick(float DeltaSeconds)
 	{
+		if (RootCapabilityNode == nullptr)
+		{
+			return;
+		}
+		// Lets the benchmarks tell the tree's allocations from the rest of the frame
+		JesterMemory::EnterToolboxScope();
 		UpdateCapabilityNodes(DeltaSeconds);
+		JesterMemory::LeaveToolboxScope();
 	}
 
 	private void AddCapabilityBranch(UCapabilityNode_AS RootNode)
 	{
-		if (RootNode == nullptr)
+		if (RootNode == nullptr || RootCapabilityNode == nullptr)
 		{
 			return;
 		}
@@ -147,6 +275,7 @@ class UCapabilitySystemComponent_AS : UActorComponent
 	{
 		FCapabilityNodeExecutionResult Result = RootCapabilityNode.UpdateActiveNodes(this);
 		ActiveCapabilities = Result.EnabledCapabilities;
+		JesterStats::AddCapabilityUpdate(ActiveCapabilities.Num());
 		for (UCapability_AS Capability : ActiveCapabilities)
 		{
 			if (Capability != nullptr)
@@ -171,14 +300,21 @@ class UCapabilitySystemComponent_AS : UActorComponent
 	UFUNCTION()
 	void ShowImGui()
 	{
-		ImGui::Text(f"Capabilities ({Capabilities.Num()}):");
+		JesterText::Begin("Capabilities (");
+		JesterText::AppendInt(Capabilities.Num());
+		JesterText::Append("):");
+		ImGui::Text(JesterText::Get());
 		ImGui::Separator();
 		ImGui::Text("Prevented Capabilities:");
 		ImGui::Indent();
 		PreventedCapabilities.ShowImGui();
 		ImGui::Unindent();
 
-		if (ImGui::TreeNode("Capability Tree"))
+		if (RootCapabilityNode == nullptr)
+		{
+			ImGui::Text("Loading soft capabilities...");
+		}
+		else if (ImGui::TreeNode("Capability Tree"))
 		{
 			RootCapabilityNode.ShowImGui();
 			ImGui::TreePop();
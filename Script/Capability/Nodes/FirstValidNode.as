@@ -54,7 +54,7 @@ class UCompoundFirstValidNode_AS : UCapabilityNode_AS
      */
     UCompoundFirstValidNode_AS Or(TSubclassOf<UCapability_AS> CapabilityClass)
     {
-        UCapability_AS Capability = Cast<UCapability_AS>(NewObject(this, CapabilityClass));
+        UCapability_AS Capability = Cast<UCapability_AS>(JesterCapability::AcquireCapabilityObject(this, CapabilityClass));
         return Or(Capability.GenerateCompoundNode());
     }
 
@@ -95,6 +95,18 @@ class UCompoundFirstValidNode_AS : UCapabilityNode_AS
         return Result;  
     }
 
+    void ReleaseToPool(UJesterObjectPoolSubsystem Pool) override
+    {
+        for (UCapabilityNode_AS ChildNode : ChildNodes)
+        {
+            ChildNode.ReleaseToPool(Pool);
+        }
+        ChildNodes.Reset();
+        CurrentNodeIndex = 0;
+        bCurrentNodeIsEnabled = false;
+        Super::ReleaseToPool(Pool);
+    }
+
     void AbortFromParent() override
     {
         Super::AbortFromParent();
@@ -71,6 +71,14 @@ class ULeafNode_AS : UCapabilityNode_AS
         return Result;
     }
     
+    void ReleaseToPool(UJesterObjectPoolSubsystem Pool) override
+    {
+        Pool.Release(Capability);
+        Capability = nullptr;
+        CapabilityClass = nullptr;
+        Super::ReleaseToPool(Pool);
+    }
+
 #ifdef IMGUI
     void ShowImGui() override
     {
@@ -50,7 +50,7 @@ class UParallelSequence_AS : UCapabilityNode_AS
      */
     UParallelSequence_AS Do(TSubclassOf<UCapability_AS> CapabilityClass)
     {
-        UCapability_AS Capability = NewObject(this, CapabilityClass);
+        UCapability_AS Capability = Cast<UCapability_AS>(JesterCapability::AcquireCapabilityObject(this, CapabilityClass));
         return Do(Capability.GenerateCompoundNode());
     }
 
@@ -70,6 +70,17 @@ class UParallelSequence_AS : UCapabilityNode_AS
         return Result; 
     }
 
+    void ReleaseToPool(UJesterObjectPoolSubsystem Pool) override
+    {
+        for (UCapabilityNode_AS ChildNode : ChildNodes)
+        {
+            ChildNode.ReleaseToPool(Pool);
+        }
+        ChildNodes.Reset();
+        bAnyNodeWasEnabled = false;
+        Super::ReleaseToPool(Pool);
+    }
+
     void AbortFromParent() override
     {
         Super::AbortFromParent();
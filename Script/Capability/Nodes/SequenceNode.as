@@ -54,7 +54,7 @@ class UCompoundSequence_AS : UCapabilityNode_AS
      */
     UCompoundSequence_AS Then(TSubclassOf<UCapability_AS> CapabilityClass)
     {
-        UCapability_AS Capability = NewObject(this, CapabilityClass);
+        UCapability_AS Capability = Cast<UCapability_AS>(JesterCapability::AcquireCapabilityObject(this, CapabilityClass));
         return Then(Capability.GenerateCompoundNode());
     }
 
@@ -104,6 +104,18 @@ class UCompoundSequence_AS : UCapabilityNode_AS
         return Result;  
     }
 
+    void ReleaseToPool(UJesterObjectPoolSubsystem Pool) override
+    {
+        for (UCapabilityNode_AS ChildNode : ChildNodes)
+        {
+            ChildNode.ReleaseToPool(Pool);
+        }
+        ChildNodes.Reset();
+        CurrentNodeIndex = 0;
+        bCurrentNodeWasEnabled = false;
+        Super::ReleaseToPool(Pool);
+    }
+
     void AbortFromParent() override
     {
         Super::AbortFromParent();
@@ -54,7 +54,7 @@ class UCompoundStatefulFirstValidNode_AS : UCapabilityNode_AS
      */
     UCompoundStatefulFirstValidNode_AS State(TSubclassOf<UCapability_AS> CapabilityClass)
     {
-        UCapability_AS Capability = NewObject(this, CapabilityClass);
+        UCapability_AS Capability = Cast<UCapability_AS>(JesterCapability::AcquireCapabilityObject(this, CapabilityClass));
         return State(Capability.GenerateCompoundNode());
     }
 
@@ -97,6 +97,18 @@ class UCompoundStatefulFirstValidNode_AS : UCapabilityNode_AS
         return Result;  
     }
 
+    void ReleaseToPool(UJesterObjectPoolSubsystem Pool) override
+    {
+        for (UCapabilityNode_AS ChildNode : ChildNodes)
+        {
+            ChildNode.ReleaseToPool(Pool);
+        }
+        ChildNodes.Reset();
+        CurrentNodeIndex = 0;
+        bHasEnabledChild = false;
+        Super::ReleaseToPool(Pool);
+    }
+
     void AbortFromParent() override
     {
         Super::AbortFromParent();
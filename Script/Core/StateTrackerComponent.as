@@ -17,7 +17,7 @@ struct FJesterState
 	FGameplayTagContainer BlockedActions;
 }
 
-class UStateTrackerComponent_AS : UActorComponent
+class UStateTrackerComponent_AS : UJesterStateTrackerComponent
 {
 	UPROPERTY()
 	FStateTrackerStateEvent OnStateChanged;
@@ -28,6 +28,33 @@ class UStateTrackerComponent_AS : UActorComponent
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly)
 	FGameplayTagContainer CurrentStates;
 
+	// States replicate as bits over the StateMap keys, asked for the first time a state is set or replicated
+	UFUNCTION(BlueprintOverride)
+	TArray<FGameplayTag> GetTrackedStates() const
+	{
+		TArray<FGameplayTag> States;
+		for (auto Element : StateMap)
+		{
+			States.Add(Element.Key);
+		}
+		return States;
+	}
+
+	// Clients rebuild CurrentStates from the replicated bits, states they set themselves aren't reported again
+	UFUNCTION(BlueprintOverride)
+	void OnReplicatedStateChanged(FGameplayTag StateTag, bool bAdded)
+	{
+		if (bAdded)
+		{
+			CurrentStates.AddTag(StateTag);
+		}
+		else
+		{
+			CurrentStates.RemoveTag(StateTag);
+		}
+		OnStateChanged.Broadcast(this, StateTag, bAdded);
+	}
+
 	UFUNCTION(BlueprintCallable, Category = "ViceStateTracker")
 	void AddState(FGameplayTag StateTag)
 	{
@@ -48,6 +75,7 @@ class UStateTrackerComponent_AS : UActorComponent
 		}
 
 		CurrentStates.AddTag(StateTag);
+		SetStateReplicated(StateTag, true);
 		OnStateChanged.Broadcast(this, StateTag, true);
 	}
 
@@ -60,6 +88,7 @@ class UStateTrackerComponent_AS : UActorComponent
 		}
 
 		CurrentStates.RemoveTag(StateTag);
+		SetStateReplicated(StateTag, false);
 		OnStateChanged.Broadcast(this, StateTag, false);
 	}
 
@@ -48,6 +48,13 @@ class UJesterActorPickerWindow : UImGuiWindow
 	UPROPERTY()
 	FString ActorFilterText = "";
 
+	// List only the actors registered in the spatial grid around the player pawn
+	UPROPERTY()
+	bool bNearbyOnly = false;
+
+	UPROPERTY()
+	float NearbyRadius = 2000.0f;
+
 	UFUNCTION(BlueprintOverride, meta = (BlueprintThreadSafe))
 	void OnPostInitProperties()
 	{
@@ -94,6 +101,16 @@ class UJesterActorPickerWindow : UImGuiWindow
 		// Toggle highlight checkbox
 		ImGui::Checkbox("Show Highlight", bShowHighlight);
 
+		ImGui::SameLine();
+		ImGui::Checkbox("Nearby Only", bNearbyOnly);
+		if (bNearbyOnly)
+		{
+			ImGui::SameLine();
+			ImGui::PushItemWidth(150.0f);
+			ImGui::SliderFloat("Radius", NearbyRadius, 100.0f, 20000.0f);
+			ImGui::PopItemWidth();
+		}
+
 		ImGui::Separator();
 
 		// Actor selection dropdown with filter
@@ -137,9 +154,11 @@ class UJesterActorPickerWindow : UImGuiWindow
 				return;
 			}
 
-			ImGui::Text(f"Selected Actor: {SelectedActor.GetName()}");
-			ImGui::Text(f"Class: {SelectedActor.Class.GetName()}");
-			ImGui::Text(f"Location: {SelectedActor.GetActorLocation().ToString()}");
+			ImGui::ValueText("Selected Actor", SelectedActor);
+			ImGui::ValueText("Class", SelectedActor.Class);
+			JesterText::Begin("Location: ");
+			JesterText::AppendVector(SelectedActor.GetActorLocation());
+			ImGui::Text(JesterText::Get());
 
 			ImGui::Separator();
 
@@ -159,7 +178,10 @@ class UJesterActorPickerWindow : UImGuiWindow
 
 			// Show all components in a resizable child window
 			ImGui::Separator();
-			ImGui::Text(f"Components ({CachedComponents.Num()}):");
+			JesterText::Begin("Components (");
+			JesterText::AppendInt(CachedComponents.Num());
+			JesterText::Append("):");
+			ImGui::Text(JesterText::Get());
 
 			// Create a resizable child window for components that auto-adjusts height
 			if (ImGui::BeginChild("ComponentsList", FVector2f(0, 0), false, EImGuiWindowFlags::None))
@@ -169,15 +191,20 @@ class UJesterActorPickerWindow : UImGuiWindow
 					if (!System::IsValid(Component))
 						continue;
 
-					FString CompName = Component.GetName().ToString();
-					FString CompClass = Component.Class.GetName().ToString();
 					bool bHasShowImGui = Jester::HasFunctionWithName(Component, n"ShowImGui");
 
 					// Show component with different styling based on whether it has ShowImGui
 					if (bHasShowImGui)
 					{
 						// Has ShowImGui - show as tree node
-						if (ImGui::TreeNode(f"[+] {CompName} ({CompClass})##comp_{Component.GetFullName()}"))
+						// Component names are unique within the actor, so the name doubles as the ImGui id
+						JesterText::Begin("[+] ");
+						JesterText::AppendObjectName(Component);
+						JesterText::Append(" (");
+						JesterText::AppendObjectName(Component.Class);
+						JesterText::Append(")##comp_");
+						JesterText::AppendObjectName(Component);
+						if (ImGui::TreeNode(JesterText::Get()))
 						{
 							ImGui::BeginGroupPanel(f"", FVector2D(ImGui::GetWindowContentRegionWidth() - ImGui::GetCursorPosX(), 0));
 							Jester::CallFunctionByName(Component, n"ShowImGui");
@@ -189,7 +216,12 @@ class UJesterActorPickerWindow : UImGuiWindow
 					{
 						// No ShowImGui - show as disabled text
 						ImGui::BeginDisabled();
-						ImGui::Text(f"    {CompName} ({CompClass})");
+						JesterText::Begin("    ");
+						JesterText::AppendObjectName(Component);
+						JesterText::Append(" (");
+						JesterText::AppendObjectName(Component.Class);
+						JesterText::Append(")");
+						ImGui::Text(JesterText::Get());
 						ImGui::EndDisabled();
 					}
 				}
@@ -280,9 +312,17 @@ class UJesterActorPickerWindow : UImGuiWindow
 	{
 		// Only search for actors when dropdown is open (lazy loading)
 
-		// Get all actors in the world
 		TArray<AActor> AllActors;
-		GetAllActorsOfClass(AActor, AllActors);
+		UJesterSpatialGridSubsystem SpatialGrid = UJesterSpatialGridSubsystem::Get();
+		if (bNearbyOnly && SpatialGrid != nullptr && PC.ControlledPawn != nullptr)
+		{
+			SpatialGrid.QueryRadius(PC.ControlledPawn.ActorLocation, NearbyRadius, AllActors);
+		}
+		else
+		{
+			// Get all actors in the world
+			GetAllActorsOfClass(AActor, AllActors);
+		}
 
 		// Show count of actors
 		int32 FilteredCount = 0;
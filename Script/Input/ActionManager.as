@@ -9,7 +9,8 @@
  * - Tag-based action registration and lookup
  * - Action state tracking (active, triggered, completed)
  * - Timing information for recent actions
- * - Debug logging and ImGui visualization
+ * - Native event handling, script is only notified of the events set with SetNotifiedEvents
+ * - Verbose input logs and ImGui visualization
  *
  * Usage Example:
  * ```
@@ -30,136 +31,22 @@
  * }
  * ```
  */
-class UActionManager_AS : UActorComponent
+class UActionManager_AS : UJesterInputRouterComponent
 {
 	// Legacy array - consider removing in favor of the map-based approach
 	TArray<FRegisteredInputAction> RegisteredInputActions;
 
-	/** Enhanced input component that handles the actual input binding */
-	UEnhancedInputComponent InputComponent;
-
-	/** Map of gameplay tags to registered input actions for fast lookup */
-	UPROPERTY()
-	private TMap<FGameplayTag, FRegisteredInputAction> RegisteredActions;
-
-	/** Reverse map for looking up tags from input actions during callbacks */
-	private TMap<UInputAction, FGameplayTag> ActionToTagMap;
-
-	/** Runtime data tracking action states and timing information */
-	private TMap<FGameplayTag, FRegisteredInputActionRuntimeData> RegisteredActionsRuntimeData;
-
-	bool bIsInitialized = false;
-
-	/** Debug logging for input events */
-	private FLogHistory LogHistory = FLogHistory(true, true, true, true, n"Input");
-
 	/**
 	 * Registers an input action with the action manager
 	 *
-	 * This creates the mapping between gameplay tags and input actions, and sets up
-	 * the runtime data tracking for the action. Each action can only be registered once.
+	 * The native router binds the action and tracks its state, IsActionActive and the
+	 * WasAction* queries read that state. Each action can only be registered once.
 	 *
 	 * @param RegisteredAction The action configuration to register
 	 */
 	void RegisterAction(FRegisteredInputAction RegisteredAction)
 	{
-		RegisteredActions.Add(RegisteredAction.ActionTag, RegisteredAction);
-		RegisteredActionsRuntimeData.Add(RegisteredAction.ActionTag, FRegisteredInputActionRuntimeData());
-		ActionToTagMap.Add(RegisteredAction.Action, RegisteredAction.ActionTag);
-
-		if (bIsInitialized)
-		{
-			// If already initialized, register the action immediately
-			RegisterActionInternal(RegisteredAction);
-		}
-	}
-
-	/**
-	 * Checks if an action is currently active (pressed/held down)
-	 *
-	 * @param ActionTag The gameplay tag identifying the action
-	 * @return True if the action is currently being held down
-	 */
-	UFUNCTION(BlueprintPure)
-	bool IsActionActive(FGameplayTag ActionTag) const
-	{
-		if (RegisteredActionsRuntimeData.Contains(ActionTag))
-		{
-			return RegisteredActionsRuntimeData[ActionTag].bIsActive;
-		}
-		return false;
-	}
-
-	/**
-	 * Checks if an action was triggered within a specified time window
-	 *
-	 * Useful for implementing input buffering or checking for recent button presses.
-	 *
-	 * @param ActionTag The gameplay tag identifying the action
-	 * @param MaxTimeAgo Maximum time in seconds to look back
-	 * @return True if the action was triggered within the time window
-	 */
-	UFUNCTION(BlueprintPure)
-	bool WasActionTriggered(FGameplayTag ActionTag, float MaxTimeAgo) const
-	{
-		if (RegisteredActionsRuntimeData.Contains(ActionTag))
-		{
-			if (RegisteredActionsRuntimeData[ActionTag].LastTimeTriggered <= 0.0)
-			{
-				return false;
-			}
-
-			return Gameplay::GetTimeSeconds() - RegisteredActionsRuntimeData[ActionTag].LastTimeTriggered <= MaxTimeAgo;
-		}
-		return false;
-	}
-
-	/**
-	 * Checks if an action was activated (started) within a specified time window
-	 *
-	 * Different from triggered - this specifically tracks when the action first became active.
-	 *
-	 * @param ActionTag The gameplay tag identifying the action
-	 * @param MaxTimeAgo Maximum time in seconds to look back
-	 * @return True if the action was activated within the time window
-	 */
-	UFUNCTION(BlueprintPure)
-	bool WasActionActivated(FGameplayTag ActionTag, float MaxTimeAgo) const
-	{
-		if (RegisteredActionsRuntimeData.Contains(ActionTag))
-		{
-			if (RegisteredActionsRuntimeData[ActionTag].LastActivationStartTime <= 0.0)
-			{
-				return false;
-			}
-
-			return Gameplay::GetTimeSeconds() - RegisteredActionsRuntimeData[ActionTag].LastActivationStartTime <= MaxTimeAgo;
-		}
-		return false;
-	}
-
-	/**
-	 * Checks if an action was completed (released) within a specified time window
-	 *
-	 * Useful for detecting recent button releases or action completions.
-	 *
-	 * @param ActionTag The gameplay tag identifying the action
-	 * @param MaxTimeAgo Maximum time in seconds to look back
-	 * @return True if the action was completed within the time window
-	 */
-	UFUNCTION(BlueprintPure)
-	bool WasActionCompleted(FGameplayTag ActionTag, float MaxTimeAgo) const
-	{
-		if (RegisteredActionsRuntimeData.Contains(ActionTag))
-		{
-			if (RegisteredActionsRuntimeData[ActionTag].LastTimeCompleted <= 0.0)
-			{
-				return false;
-			}
-
-			return Gameplay::GetTimeSeconds() - RegisteredActionsRuntimeData[ActionTag].LastTimeCompleted <= MaxTimeAgo;
-		}
-		return false;
+		RegisterInputAction(RegisteredAction.ActionTag, RegisteredAction.Action);
 	}
 
 	/**
@@ -172,101 +59,11 @@ class UActionManager_AS : UActorComponent
 		APawn PlayerPawn = Cast<APawn>(GetOwner());
 		check(PlayerPawn != nullptr, "ActionManager_AS must be placed on a Pawn.");
 
-		// Create the enhanced input component for handling input events
-		InputComponent = UEnhancedInputComponent::Create(GetOwner(), n"ActionManagerInputComponent");
-
-		// Bind all registered actions to their respective event handlers
-		for (auto EachAction : RegisteredActions)
-		{
-			RegisterActionInternal(EachAction.Value);
-		}
-
-		bIsInitialized = true;
-		LogHistory.AddLog(f"ActionManager initialized with {RegisteredActions.Num()} actions.", EJesterLogVerbosity::Verbose);
-	}
-
-	void RegisterActionInternal(const FRegisteredInputAction& EachAction)
-	{
-		// Create delegate bindings for different input events
-		FEnhancedInputActionHandlerDynamicSignature StartActionBinding;
-		StartActionBinding.BindUFunction(this, n"HandleActionStart");
-
-		FEnhancedInputActionHandlerDynamicSignature EndActionBinding;
-		EndActionBinding.BindUFunction(this, n"HandleActionCompleted");
-
-		FEnhancedInputActionHandlerDynamicSignature TriggeredActionBinding;
-		TriggeredActionBinding.BindUFunction(this, n"HandleActionTriggered");
+		// Create the enhanced input component for handling input events, the router keeps it
+		UEnhancedInputComponent ActionInputComponent = UEnhancedInputComponent::Create(GetOwner(), n"ActionManagerInputComponent");
 
-		FEnhancedInputActionHandlerDynamicSignature CancelActionBinding;
-		CancelActionBinding.BindUFunction(this, n"HandleActionCancelled");
-
-		// Bind all event types for comprehensive action tracking
-		InputComponent.BindAction(EachAction.Action, ETriggerEvent::Started, StartActionBinding);
-		InputComponent.BindAction(EachAction.Action, ETriggerEvent::Completed, EndActionBinding);
-		InputComponent.BindAction(EachAction.Action, ETriggerEvent::Canceled, CancelActionBinding);
-		InputComponent.BindAction(EachAction.Action, ETriggerEvent::Triggered, TriggeredActionBinding);
-	}
-
-	/**
-	 * Handles the start event when an action begins (key/button pressed)
-	 * Updates runtime data to mark the action as active and record timing
-	 */
-	UFUNCTION()
-	private void HandleActionStart(FInputActionValue ActionValue, float32 ElapsedTime, float32 TriggeredTime, const UInputAction SourceAction)
-	{
-		FGameplayTag ActionTag = ActionToTagMap[SourceAction];
-		FRegisteredInputActionRuntimeData& RuntimeData = RegisteredActionsRuntimeData[ActionTag];
-
-		LogHistory.AddLog(f"Action {SourceAction.GetName()} started with value {ActionValue.ToString()} at time {Gameplay::GetTimeSeconds()}.", EJesterLogVerbosity::Verbose);
-
-		RuntimeData.LastActivationStartTime = Gameplay::GetTimeSeconds();
-		RuntimeData.bIsActive = true;
-	}
-
-	/**
-	 * Handles the completion event when an action ends (key/button released)
-	 * Updates runtime data to mark the action as inactive and record completion time
-	 */
-	UFUNCTION()
-	private void HandleActionCompleted(FInputActionValue ActionValue, float32 ElapsedTime, float32 TriggeredTime, const UInputAction SourceAction)
-	{
-		FGameplayTag ActionTag = ActionToTagMap[SourceAction];
-		FRegisteredInputActionRuntimeData& RuntimeData = RegisteredActionsRuntimeData[ActionTag];
-
-		LogHistory.AddLog(f"Action {SourceAction.GetName()} completed with value {ActionValue.ToString()} at time {Gameplay::GetTimeSeconds()}.", EJesterLogVerbosity::Verbose);
-
-		RuntimeData.LastTimeCompleted = Gameplay::GetTimeSeconds();
-		RuntimeData.bIsActive = false;
-	}
-
-	/**
-	 * Handles the triggered event during action execution
-	 * Called continuously while the action is active (for continuous inputs)
-	 */
-	UFUNCTION()
-	private void HandleActionTriggered(FInputActionValue ActionValue, float32 ElapsedTime, float32 TriggeredTime, const UInputAction SourceAction)
-	{
-		FGameplayTag ActionTag = ActionToTagMap[SourceAction];
-		FRegisteredInputActionRuntimeData& RuntimeData = RegisteredActionsRuntimeData[ActionTag];
-
-		LogHistory.AddLog(f"Action {SourceAction.GetName()} triggered with value {ActionValue.ToString()} at time {Gameplay::GetTimeSeconds()}.", EJesterLogVerbosity::Verbose);
-
-		RuntimeData.LastTimeTriggered = Gameplay::GetTimeSeconds();
-	}
-
-	/**
-	 * Handles the cancellation event when an action is interrupted
-	 * Updates runtime data to mark the action as inactive
-	 */
-	UFUNCTION()
-	private void HandleActionCancelled(FInputActionValue ActionValue, float32 ElapsedTime, float32 TriggeredTime, const UInputAction SourceAction)
-	{
-		FGameplayTag ActionTag = ActionToTagMap[SourceAction];
-		FRegisteredInputActionRuntimeData& RuntimeData = RegisteredActionsRuntimeData[ActionTag];
-
-		LogHistory.AddLog(f"Action {SourceAction.GetName()} cancelled with value {ActionValue.ToString()} at time {Gameplay::GetTimeSeconds()}.", EJesterLogVerbosity::Verbose);
-
-		RuntimeData.bIsActive = false;
+		// Input events are handled natively, script only hears about the events asked for with SetNotifiedEvents
+		InitializeRouter(ActionInputComponent);
 	}
 
 #ifdef IMGUI
@@ -280,23 +77,20 @@ class UActionManager_AS : UActorComponent
 		ImGui::Text("Registered Actions:");
 		ImGui::Indent();
 
-		for (auto& EachAction : RegisteredActions)
+		for (int i = 0; i < GetNumActions(); i++)
 		{
-			FString ActionName = EachAction.Value.Action != nullptr ? EachAction.Value.Action.GetName().ToString() : "None";
-			ImGui::Text(f"Action: {ActionName}");
-			ImGui::Text(f"Tag: {EachAction.Value.ActionTag.ToString()}");
-
-			FRegisteredInputActionRuntimeData& RuntimeData = RegisteredActionsRuntimeData[EachAction.Value.ActionTag];
-			ImGui::Text(f"Last Triggered: {RuntimeData.LastTimeTriggered}");
-			ImGui::Text(f"Last Completed: {RuntimeData.LastTimeCompleted}");
-			ImGui::Text(f"Last Activation Start: {RuntimeData.LastActivationStartTime}");
-			ImGui::BoolText("Is Active", RuntimeData.bIsActive);
+			FJesterActionState State = GetActionState(i);
+			ImGui::ValueText("Action", State.Action);
+			ImGui::ValueText("Tag", State.ActionTag);
+			ImGui::ValueText("Last Triggered", State.LastTimeTriggered);
+			ImGui::ValueText("Last Completed", State.LastTimeCompleted);
+			ImGui::ValueText("Last Activation Start", State.LastActivationStartTime);
+			ImGui::BoolText("Is Active", State.bIsActive);
 
 			ImGui::Separator();
 		}
 
 		ImGui::Unindent();
-		LogHistory.ShowImGui("ActionManager Log History");
 	}
 #endif
 }
@@ -333,24 +127,3 @@ struct FRegisteredInputAction
 	/** The actual input action asset from the Enhanced Input system */
 	UInputAction Action;
 }
-
-/**
- * Runtime data structure tracking action state and timing information
- *
- * This data is updated by the action manager as input events occur.
- * Timing values use game time seconds and are set to -1 when not applicable.
- */
-struct FRegisteredInputActionRuntimeData
-{
-	/** Last time the action was triggered (continuous event) */
-	float LastTimeTriggered = -1;
-
-	/** Last time the action was completed (released) */
-	float LastTimeCompleted = -1;
-
-	/** Last time the action was activated (started) */
-	float LastActivationStartTime = -1;
-
-	/** Whether the action is currently being held/pressed */
-	bool bIsActive = false;
-};
\ No newline at end of file
@@ -55,6 +55,7 @@ struct FBoolAggregator
 	{
 		FBoolAggregatorReplicatedEntry& ReplicatedValue = FindOrAddValue(Reason);
 		ReplicatedValue.Value = Value;
+		JesterStats::AddAggregatorUpdate();
 		OnChanged.Broadcast(this);
 	}
 
@@ -81,6 +82,7 @@ struct FBoolAggregator
 	 */
 	void Remove(FString Reason)
 	{
+		JesterStats::AddAggregatorUpdate();
 		for (int i = 0; i < Values.Num(); i++)
 		{
 			if (Values[i].Reason == Reason)
@@ -136,7 +138,7 @@ struct FBoolAggregator
 	}
 
 #ifdef IMGUI
-	void ShowImGui(FString Label, bool bShowLabel = true) const
+	void ShowImGui(const FString& Label, bool bShowLabel = true) const
 	{
 		if (bShowLabel)
 		{
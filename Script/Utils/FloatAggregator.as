@@ -72,6 +72,7 @@ struct FFloatAggregator
 	{
 		FFloatAggregatorReplicatedEntry& Entry = FindOrAddValue(Reason);
 		Entry.Value = Value;
+		JesterStats::AddAggregatorUpdate();
 	}
 
 	/**
@@ -83,6 +84,7 @@ struct FFloatAggregator
 	{
 		FFloatAggregatorReplicatedEntry& Entry = FindOrAddMultiplier(Reason);
 		Entry.Value = Value;
+		JesterStats::AddAggregatorUpdate();
 	}
 
 	/**
@@ -108,6 +110,7 @@ struct FFloatAggregator
 	 */
 	void Remove(FString Reason)
 	{
+		JesterStats::AddAggregatorUpdate();
 		for (int i = 0; i < Values.Num(); i++)
 		{
 			if (Values[i].Reason == Reason)
@@ -6,6 +6,7 @@ struct FGameplayTagAggregator
 
     void AddTag(FGameplayTag Tag, FString Reason)
     {
+        JesterStats::AddAggregatorUpdate();
         TagByReason.FindOrAdd(Reason).AddTag(Tag);
         if (!CurrentTags.HasTag(Tag))
         {
@@ -15,6 +16,7 @@ struct FGameplayTagAggregator
 
     void RemoveTag(FGameplayTag Tag, FString Reason)
     {
+        JesterStats::AddAggregatorUpdate();
         FGameplayTagContainer& TagContainer = TagByReason.FindOrAdd(Reason);
         TagContainer.RemoveTag(Tag);
         if(TagContainer.Num() == 0)
@@ -48,12 +50,16 @@ struct FGameplayTagAggregator
         ImGui::Text("Current Tags:");
         for (const auto& Tag : CurrentTags.GameplayTags)
         {
-            ImGui::Text(f"- {Tag.ToString()}");
+            JesterText::Begin("- ");
+            JesterText::AppendTag(Tag);
+            ImGui::Text(JesterText::Get());
             for (const auto& Pair : TagByReason)
             {
                 if (Pair.Value.HasTag(Tag))
                 {
-                    ImGui::Text(f"  - {Pair.Key}");
+                    JesterText::Begin("  - ");
+                    JesterText::Append(Pair.Key);
+                    ImGui::Text(JesterText::Get());
                 }
             }
         }
@@ -13,6 +13,7 @@ mixin FString ToString(const FGameplayTagContainer& Container)
 	return Result;
 }
 
+// For state checked every frame, FJesterTrackedTagContainer gives the changes without a diff
 mixin void CompareToShadowTagContainer(const FGameplayTagContainer& Container, const FGameplayTagContainer& ShadowContainer, TArray<FGameplayTag>& out AddedTags, TArray<FGameplayTag>& out RemovedTags)
 {
 	for (FGameplayTag Tag : Container.GameplayTags)
@@ -2,7 +2,7 @@
 namespace ImGui
 {
 	// Helps with boilerplate code for ImGui::Text setting a color based on a bool value. If TrueString is empty, it will color the label instead
-	bool BoolText(const FString& Label, bool Value, FString TrueString = "True", FString FalseString = "False")
+	bool BoolText(const FString& Label, bool Value, const FString& TrueString = "True", const FString& FalseString = "False")
 	{
 		if (TrueString.IsEmpty())
 		{
@@ -15,12 +15,14 @@ namespace ImGui
 			{
 				ImGui::PushStyleColor(EImGuiCol::Text, JesterColors::Red);
 			}
-			ImGui::Text(f"{Label}");
+			ImGui::Text(Label);
 			ImGui::PopStyleColor();
 			return Value;
 		}
 
-		ImGui::Text(f"{Label}: ");
+		JesterText::Begin(Label);
+		JesterText::Append(": ");
+		ImGui::Text(JesterText::Get());
 		if (Value)
 		{
 			ImGui::PushStyleColor(EImGuiCol::Text, JesterColors::Green);
@@ -30,9 +32,58 @@ namespace ImGui
 			ImGui::PushStyleColor(EImGuiCol::Text, JesterColors::Red);
 		}
 		ImGui::SameLine();
-		ImGui::Text(f"{Value ? TrueString : FalseString}");
+		ImGui::Text(Value ? TrueString : FalseString);
 		ImGui::PopStyleColor();
 		return Value;
 	}
+
+	// "Label: Value" lines written through the shared JesterText buffer, so drawing them every frame doesn't allocate
+	void ValueText(const FString& Label, int Value)
+	{
+		JesterText::Begin(Label);
+		JesterText::Append(": ");
+		JesterText::AppendInt(Value);
+		ImGui::Text(JesterText::Get());
+	}
+
+	void ValueText(const FString& Label, float Value, int Decimals = 2)
+	{
+		JesterText::Begin(Label);
+		JesterText::Append(": ");
+		JesterText::AppendFloat(Value, Decimals);
+		ImGui::Text(JesterText::Get());
+	}
+
+	void ValueText(const FString& Label, bool Value)
+	{
+		JesterText::Begin(Label);
+		JesterText::Append(": ");
+		JesterText::AppendBool(Value);
+		ImGui::Text(JesterText::Get());
+	}
+
+	void ValueText(const FString& Label, FName Value)
+	{
+		JesterText::Begin(Label);
+		JesterText::Append(": ");
+		JesterText::AppendName(Value);
+		ImGui::Text(JesterText::Get());
+	}
+
+	void ValueText(const FString& Label, FGameplayTag Value)
+	{
+		JesterText::Begin(Label);
+		JesterText::Append(": ");
+		JesterText::AppendTag(Value);
+		ImGui::Text(JesterText::Get());
+	}
+
+	void ValueText(const FString& Label, const UObject Value)
+	{
+		JesterText::Begin(Label);
+		JesterText::Append(": ");
+		JesterText::AppendObjectName(Value);
+		ImGui::Text(JesterText::Get());
+	}
 }
 #endif
\ No newline at end of file
@@ -27,7 +27,7 @@ public class JesterToolbox : ModuleRules
 			{
 				"Core",
 				"GameplayTags", "DeveloperSettings",
-				"Engine", "EngineSettings", "GameplayTasks", "InputCore", "ModularGameplay", "ApplicationCore", "AngelscriptCode"
+				"Engine", "EngineSettings", "GameplayTasks", "InputCore", "ModularGameplay", "ApplicationCore", "AngelscriptCode", "EnhancedInput"
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
@@ -40,6 +40,7 @@ public class JesterToolbox : ModuleRules
 				"Engine",
 				"Slate",
 				"SlateCore", "AngelscriptCode",
+				"HTTPServer", "Json", "JsonUtilities",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
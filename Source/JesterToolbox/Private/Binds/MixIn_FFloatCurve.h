@@ -2,6 +2,8 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
+#include "JesterToolboxTrace.h"
+#include "Utils/ScalableMultiChannelCurve.h"
 #include "Utils/ScalableRuntimeCurve.h"
 #include "MixIn_FFloatCurve.generated.h"
 
@@ -38,6 +40,7 @@ public:
 	UFUNCTION(ScriptCallable)
 	static float Evaluate(FRichCurve const& Curve, float InTime)
 	{
+		JESTER_TRACE_SCOPE("Jester::RichCurve::Evaluate");
 		return Curve.Eval(InTime);
 	}
 };
@@ -73,6 +76,7 @@ public:
 	UFUNCTION(ScriptCallable)
 	static float Evaluate(FRuntimeFloatCurve const& Curve, float InTime)
 	{
+		JESTER_TRACE_SCOPE("Jester::RuntimeFloatCurve::Evaluate");
 		return Curve.GetRichCurveConst()->Eval(InTime);
 	}
 };
@@ -94,6 +98,7 @@ public:
 	UFUNCTION(ScriptCallable) 
 	static float Evaluate(FScalableRuntimeCurve const& ScalableCurve, float InTime)
 	{
+		JESTER_TRACE_SCOPE("Jester::ScalableRuntimeCurve::Evaluate");
 		return ScalableCurve.Evaluate(InTime);
 	}
 	
@@ -114,4 +119,72 @@ public:
 	{
 		ScalableCurve.GetTimeRange(OutTime, OutValue);
 	}
-};
\ No newline at end of file
+};
+
+UCLASS(Meta = (ScriptMixin = "FScalableMultiChannelCurve"))
+class JESTERTOOLBOX_API UMixIn_FScalableMultiChannelCurve : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(ScriptCallable)
+	static bool HasCurve(FScalableMultiChannelCurve const& Curve)
+	{
+		return Curve.HasCurve();
+	}
+
+	UFUNCTION(ScriptCallable)
+	static int GetNumKeys(FScalableMultiChannelCurve const& Curve)
+	{
+		return Curve.GetNumKeys();
+	}
+
+	UFUNCTION(ScriptCallable)
+	static FVector4 Evaluate(FScalableMultiChannelCurve const& Curve, float InTime)
+	{
+		JESTER_TRACE_SCOPE("Jester::ScalableMultiChannelCurve::Evaluate");
+		return FVector4(Curve.Evaluate(InTime));
+	}
+
+	UFUNCTION(ScriptCallable)
+	static FVector EvaluateVector(FScalableMultiChannelCurve const& Curve, float InTime)
+	{
+		JESTER_TRACE_SCOPE("Jester::ScalableMultiChannelCurve::Evaluate");
+		return Curve.EvaluateVector(InTime);
+	}
+
+	UFUNCTION(ScriptCallable)
+	static FLinearColor EvaluateColor(FScalableMultiChannelCurve const& Curve, float InTime)
+	{
+		JESTER_TRACE_SCOPE("Jester::ScalableMultiChannelCurve::Evaluate");
+		return Curve.EvaluateColor(InTime);
+	}
+
+	// Times in increasing order are evaluated with a single pass over the keys
+	UFUNCTION(ScriptCallable)
+	static void EvaluateBatch(FScalableMultiChannelCurve const& Curve, const TArray<float>& InTimes, TArray<FVector4>& OutValues)
+	{
+		JESTER_TRACE_SCOPE("Jester::ScalableMultiChannelCurve::EvaluateBatch");
+		TArray<FVector4f, TInlineAllocator<64>> Values;
+		Values.SetNumUninitialized(InTimes.Num());
+		Curve.EvaluateBatch(InTimes, Values);
+
+		OutValues.SetNumUninitialized(InTimes.Num());
+		for (int32 i = 0; i < Values.Num(); ++i)
+		{
+			OutValues[i] = FVector4(Values[i]);
+		}
+	}
+
+	UFUNCTION(ScriptCallable)
+	static void AddKeyOrSetNormalized(FScalableMultiChannelCurve& Curve, float Time, FVector4 Value, ERichCurveInterpMode InterpMode = RCIM_Linear)
+	{
+		Curve.AddKeyOrSetNormalized(Time, FVector4f(Value), InterpMode);
+	}
+
+	UFUNCTION(ScriptCallable)
+	static void GetTimeBounds(FScalableMultiChannelCurve const& Curve, float& OutTimeStart, float& OutTimeEnd)
+	{
+		Curve.GetTimeBounds(OutTimeStart, OutTimeEnd);
+	}
+};
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Core/JesterAssetRef.h"
+#include "MixIn_FJesterAssetRef.generated.h"
+
+UCLASS(Meta = (ScriptMixin = "FJesterAssetRef"))
+class JESTERTOOLBOX_API UMixIn_FJesterAssetRef : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(ScriptCallable, meta=(DeterminesOutputType = "ExpectedClass"))
+	static UObject* Get(const FJesterAssetRef& AssetRef, TSubclassOf<UObject> ExpectedClass)
+	{
+		return AssetRef.Get(ExpectedClass);
+	}
+
+	UFUNCTION(ScriptCallable)
+	static bool IsSet(const FJesterAssetRef& AssetRef)
+	{
+		return AssetRef.IsSet();
+	}
+};
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Utils/JesterTrackedTagContainer.h"
+#include "MixIn_FJesterTrackedTagContainer.generated.h"
+
+UCLASS(Meta = (ScriptMixin = "FJesterTrackedTagContainer"))
+class JESTERTOOLBOX_API UMixIn_FJesterTrackedTagContainer : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(ScriptCallable)
+	static const FGameplayTagContainer& GetTags(FJesterTrackedTagContainer const& Container)
+	{
+		return Container.GetTags();
+	}
+
+	UFUNCTION(ScriptCallable)
+	static int GetGeneration(FJesterTrackedTagContainer const& Container)
+	{
+		return Container.GetGeneration();
+	}
+
+	UFUNCTION(ScriptCallable)
+	static bool HasTag(FJesterTrackedTagContainer const& Container, FGameplayTag Tag)
+	{
+		return Container.HasTag(Tag);
+	}
+
+	UFUNCTION(ScriptCallable)
+	static bool AddTag(FJesterTrackedTagContainer& Container, FGameplayTag Tag)
+	{
+		return Container.AddTag(Tag);
+	}
+
+	UFUNCTION(ScriptCallable)
+	static bool RemoveTag(FJesterTrackedTagContainer& Container, FGameplayTag Tag)
+	{
+		return Container.RemoveTag(Tag);
+	}
+
+	UFUNCTION(ScriptCallable)
+	static void AppendTags(FJesterTrackedTagContainer& Container, const FGameplayTagContainer& Other)
+	{
+		Container.AppendTags(Other);
+	}
+
+	UFUNCTION(ScriptCallable)
+	static void Reset(FJesterTrackedTagContainer& Container)
+	{
+		Container.Reset();
+	}
+
+	UFUNCTION(ScriptCallable)
+	static bool GetChangesSince(FJesterTrackedTagContainer const& Container, int& Generation, TArray<FGameplayTag>& AddedTags, TArray<FGameplayTag>& RemovedTags)
+	{
+		return Container.GetChangesSince(Generation, AddedTags, RemovedTags);
+	}
+};
@@ -4,6 +4,92 @@
 #include "Core/AssetsLocatorService.h"
 
 #include "GameplayTagContainer.h"
+#include "JesterToolbox.h"
+#include "JesterToolboxMemory.h"
+#include "JesterToolboxStats.h"
+#include "JesterToolboxTrace.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/GCObject.h"
+
+TRACE_DECLARE_INT_COUNTER(JesterAssetLookups, TEXT("JesterToolbox/AssetLookups"));
+
+namespace
+{
+	// 0 is never used so default constructed asset refs always resolve
+	uint32 GAssetsLocatorGeneration = 1;
+
+	// Only held long enough to copy the pointer
+	FRWLock GPublishedSnapshotLock;
+	FJesterAssetsSnapshotPtr GPublishedSnapshot;
+
+	// Keeps the assets of every snapshot still held by someone alive. The objects are copied here on the game thread so
+	// the GC never touches the maps workers read, snapshots nobody holds anymore are forgotten on the next collection
+	class FSnapshotReferencer : public FGCObject
+	{
+	public:
+		void Add(const FJesterAssetsSnapshotPtr& Snapshot, TArray<UObject*>&& Objects)
+		{
+			Entries.Add({ Snapshot, MoveTemp(Objects) });
+		}
+
+		// Returns whether any snapshot is still held
+		bool ForgetReleased()
+		{
+			Entries.RemoveAllSwap([](const FEntry& Entry) { return !Entry.Snapshot.IsValid(); });
+			return Entries.Num() > 0;
+		}
+
+		virtual void AddReferencedObjects(FReferenceCollector& Collector) override
+		{
+			ForgetReleased();
+			for (FEntry& Entry : Entries)
+			{
+				Collector.AddReferencedObjects(Entry.Objects);
+			}
+		}
+
+		virtual FString GetReferencerName() const override
+		{
+			return TEXT("FJesterAssetsSnapshot");
+		}
+
+	private:
+		struct FEntry
+		{
+			TWeakPtr<const FJesterAssetsSnapshot, ESPMode::ThreadSafe> Snapshot;
+			TArray<UObject*> Objects;
+		};
+		TArray<FEntry> Entries;
+	};
+
+	// Created on the first publish, the UObject system isn't up during static initialization
+	TUniquePtr<FSnapshotReferencer> GSnapshotReferencer;
+}
+
+UObject* FJesterAssetsSnapshot::FindAsset(const FGameplayTag& Tag, const UClass* ExpectedClass) const
+{
+	UObject* const* Asset = Assets.Find(Tag);
+	return Asset != nullptr && (ExpectedClass == nullptr || (*Asset)->IsA(ExpectedClass)) ? *Asset : nullptr;
+}
+
+UClass* FJesterAssetsSnapshot::FindClass(const FGameplayTag& Tag, const UClass* ExpectedClass) const
+{
+	UClass* const* Class = Classes.Find(Tag);
+	return Class != nullptr && (ExpectedClass == nullptr || (*Class)->IsChildOf(ExpectedClass)) ? *Class : nullptr;
+}
+
+uint32 UAssetsLocatorService::GetGeneration()
+{
+	return GAssetsLocatorGeneration;
+}
+
+void UAssetsLocatorService::BumpGeneration()
+{
+	if (++GAssetsLocatorGeneration == 0)
+	{
+		GAssetsLocatorGeneration = 1;
+	}
+}
 
 void UAssetsLocatorService::Initialize()
 {
@@ -11,28 +97,257 @@ void UAssetsLocatorService::Initialize()
 	{
 		return;
 	}
+	JESTER_TRACE_SCOPE("Jester::AssetsLocatorService::Initialize");
+	JESTER_LLM_SCOPE(Assets);
 	
 	Assets.Empty();
 	Classes.Empty();
+	CategoryHashes.Empty();
 	
 	// Flatten the arrays
 	for (const auto& Category : RegisteredAssets)
 	{
-		for (const auto& Pair : Category.Value.Assets)
+		AddCategory(Category.Value);
+		CategoryHashes.Add(Category.Key, HashCategory(Category.Value));
+	}
+	bInitialized = true;
+	BumpGeneration();
+
+	UpdateResidentBytes();
+	JESTER_TRACE_BOOKMARK(TEXT("JesterToolbox: AssetsLocatorService initialized (%d assets, %d classes)"), Assets.Num(), Classes.Num());
+}
+
+void UAssetsLocatorService::PublishSnapshot() const
+{
+	check(IsInGameThread());
+	JESTER_LLM_SCOPE(Assets);
+
+	TSharedPtr<FJesterAssetsSnapshot, ESPMode::ThreadSafe> Snapshot = MakeShared<FJesterAssetsSnapshot, ESPMode::ThreadSafe>();
+	TArray<UObject*> Objects;
+	Objects.Reserve(Assets.Num() + Classes.Num());
+	Snapshot->Assets.Reserve(Assets.Num());
+	for (const auto& Pair : Assets)
+	{
+		if (Pair.Value != nullptr)
 		{
-			Assets.Add(Pair.Key, Pair.Value);
+			Snapshot->Assets.Add(Pair.Key, Pair.Value);
+			Objects.Add(Pair.Value);
 		}
-		
-		for (const auto& Pair : Category.Value.Classes)
+	}
+	Snapshot->Classes.Reserve(Classes.Num());
+	for (const auto& Pair : Classes)
+	{
+		if (Pair.Value != nullptr)
 		{
-			Classes.Add(Pair.Key, Pair.Value);
+			Snapshot->Classes.Add(Pair.Key, Pair.Value.Get());
+			Objects.Add(Pair.Value.Get());
 		}
 	}
-	bInitialized = true;
+	Snapshot->Generation = GetGeneration();
+
+	if (!GSnapshotReferencer.IsValid())
+	{
+		GSnapshotReferencer = MakeUnique<FSnapshotReferencer>();
+	}
+	GSnapshotReferencer->Add(Snapshot, MoveTemp(Objects));
+
+	FWriteScopeLock Lock(GPublishedSnapshotLock);
+	GPublishedSnapshot = MoveTemp(Snapshot);
+}
+
+void UAssetsLocatorService::ClearPublishedSnapshot()
+{
+	check(IsInGameThread());
+	{
+		FWriteScopeLock Lock(GPublishedSnapshotLock);
+		GPublishedSnapshot.Reset();
+	}
+
+	// Not left for static destruction, after the UObject system is gone
+	if (GSnapshotReferencer.IsValid() && !GSnapshotReferencer->ForgetReleased())
+	{
+		GSnapshotReferencer.Reset();
+	}
+}
+
+FJesterAssetsSnapshotPtr UAssetsLocatorService::GetPublishedSnapshot()
+{
+	FReadScopeLock Lock(GPublishedSnapshotLock);
+	return GPublishedSnapshot;
+}
+
+#if WITH_EDITOR
+void UAssetsLocatorService::RefreshFromDefaults()
+{
+	const UAssetsLocatorService* Defaults = GetClass()->GetDefaultObject<UAssetsLocatorService>();
+	if (!bInitialized || Defaults == this)
+	{
+		return;
+	}
+	JESTER_TRACE_SCOPE("Jester::AssetsLocatorService::RefreshFromDefaults");
+	JESTER_LLM_SCOPE(Assets);
+
+	RegisteredLevels = Defaults->RegisteredLevels;
+
+	// Tags of the categories that changed, before and after the edit
+	TSet<FGameplayTag> DirtyAssetTags;
+	TSet<FGameplayTag> DirtyClassTags;
+	auto MarkDirty = [&DirtyAssetTags, &DirtyClassTags](const FAssetCategory& Category)
+	{
+		for (const auto& Pair : Category.Assets)
+		{
+			DirtyAssetTags.Add(Pair.Key);
+		}
+		for (const auto& Pair : Category.Classes)
+		{
+			DirtyClassTags.Add(Pair.Key);
+		}
+	};
+
+	// Reordered categories override each other differently, every tag has to be resolved again
+	auto GetCommonOrder = [](const TMap<FString, FAssetCategory>& Categories, const TMap<FString, FAssetCategory>& OtherCategories)
+	{
+		TArray<FString> Order;
+		for (const auto& Category : Categories)
+		{
+			if (OtherCategories.Contains(Category.Key))
+			{
+				Order.Add(Category.Key);
+			}
+		}
+		return Order;
+	};
+	const bool bOrderChanged = GetCommonOrder(RegisteredAssets, Defaults->RegisteredAssets) != GetCommonOrder(Defaults->RegisteredAssets, RegisteredAssets);
+
+	bool bChanged = bOrderChanged;
+	for (const auto& Category : RegisteredAssets)
+	{
+		if (bOrderChanged || !Defaults->RegisteredAssets.Contains(Category.Key))
+		{
+			MarkDirty(Category.Value);
+		}
+		if (!Defaults->RegisteredAssets.Contains(Category.Key))
+		{
+			bChanged = true;
+			UE_LOG(LogJesterToolbox, Log, TEXT("AssetsLocatorService removed category %s"), *Category.Key);
+		}
+	}
+
+	TMap<FString, uint32> NewCategoryHashes;
+	for (const auto& Category : Defaults->RegisteredAssets)
+	{
+		const uint32 Hash = HashCategory(Category.Value);
+		NewCategoryHashes.Add(Category.Key, Hash);
+
+		const uint32* PreviousHash = CategoryHashes.Find(Category.Key);
+		if (PreviousHash != nullptr && *PreviousHash == Hash)
+		{
+			continue;
+		}
+
+		if (const FAssetCategory* PreviousCategory = RegisteredAssets.Find(Category.Key))
+		{
+			MarkDirty(*PreviousCategory);
+		}
+		MarkDirty(Category.Value);
+		bChanged = true;
+		UE_LOG(LogJesterToolbox, Log, TEXT("AssetsLocatorService refreshed category %s"), *Category.Key);
+	}
+
+	if (bChanged)
+	{
+		// Same order as the defaults, so the override order matches a fresh Initialize
+		RegisteredAssets = Defaults->RegisteredAssets;
+		CategoryHashes = MoveTemp(NewCategoryHashes);
+		ResolveTags(DirtyAssetTags, DirtyClassTags);
+		BumpGeneration();
+		UpdateResidentBytes();
+	}
+}
+
+void UAssetsLocatorService::CopyFlattenedTables(const UAssetsLocatorService& Previous)
+{
+	RegisteredAssets = Previous.RegisteredAssets;
+	Assets = Previous.Assets;
+	Classes = Previous.Classes;
+	CategoryHashes = Previous.CategoryHashes;
+	bInitialized = Previous.bInitialized;
+}
+#endif
+
+void UAssetsLocatorService::AddCategory(const FAssetCategory& Category)
+{
+	for (const auto& Pair : Category.Assets)
+	{
+		Assets.Add(Pair.Key, Pair.Value);
+	}
+	
+	for (const auto& Pair : Category.Classes)
+	{
+		Classes.Add(Pair.Key, Pair.Value);
+	}
+}
+
+void UAssetsLocatorService::ResolveTags(const TSet<FGameplayTag>& AssetTags, const TSet<FGameplayTag>& ClassTags)
+{
+	for (const FGameplayTag& Tag : AssetTags)
+	{
+		Assets.Remove(Tag);
+		for (const auto& Category : RegisteredAssets)
+		{
+			if (UObject* const* Asset = Category.Value.Assets.Find(Tag))
+			{
+				Assets.Add(Tag, *Asset);
+			}
+		}
+	}
+
+	for (const FGameplayTag& Tag : ClassTags)
+	{
+		Classes.Remove(Tag);
+		for (const auto& Category : RegisteredAssets)
+		{
+			if (const TSubclassOf<UObject>* Class = Category.Value.Classes.Find(Tag))
+			{
+				Classes.Add(Tag, *Class);
+			}
+		}
+	}
+}
+
+uint32 UAssetsLocatorService::HashCategory(const FAssetCategory& Category)
+{
+	uint32 Hash = 0;
+	for (const auto& Pair : Category.Assets)
+	{
+		Hash = HashCombine(Hash, HashCombine(GetTypeHash(Pair.Key), GetTypeHash(Pair.Value)));
+	}
+	for (const auto& Pair : Category.Classes)
+	{
+		Hash = HashCombine(Hash, HashCombine(GetTypeHash(Pair.Key), GetTypeHash(Pair.Value.Get())));
+	}
+	return Hash;
+}
+
+void UAssetsLocatorService::UpdateResidentBytes()
+{
+	int64 ResidentBytes = 0;
+	for (const auto& Pair : Assets)
+	{
+		if (Pair.Value != nullptr)
+		{
+			ResidentBytes += Pair.Value->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+		}
+	}
+	SET_MEMORY_STAT(STAT_JesterLocatorResidentBytes, ResidentBytes);
+	JesterStats::Set(JesterStats::ECounter::LocatorResidentBytes, ResidentBytes);
 }
 
 UObject* UAssetsLocatorService::GetAsset(const FGameplayTag& Tag, const TSubclassOf<UObject>& ExpectedClass) const
 {
+	JESTER_TRACE_SCOPE("Jester::AssetsLocatorService::GetAsset");
+	JESTER_TRACE_COUNTER_INCREMENT(JesterAssetLookups);
+	JESTER_STAT_INC(AssetLookups);
 	if (const auto Asset = Assets.Find(Tag))
 	{
 		checkf(ExpectedClass == nullptr || (*Asset)->GetClass()->IsChildOf(ExpectedClass),
@@ -47,6 +362,9 @@ UObject* UAssetsLocatorService::GetAsset(const FGameplayTag& Tag, const TSubclas
 
 TSubclassOf<UObject> UAssetsLocatorService::GetAssetClass(const FGameplayTag& Tag, const TSubclassOf<UObject>& ExpectedClass) const
 {
+	JESTER_TRACE_SCOPE("Jester::AssetsLocatorService::GetAssetClass");
+	JESTER_TRACE_COUNTER_INCREMENT(JesterAssetLookups);
+	JESTER_STAT_INC(AssetLookups);
 	if (const auto Asset = Classes.Find(Tag))
 	{
 		checkf(ExpectedClass == nullptr || Asset->Get()->IsChildOf(ExpectedClass),
@@ -3,7 +3,15 @@
 
 #include "Core/GameStateInitialization.h"
 
+#include "Algo/StableSort.h"
 #include "JesterToolbox.h"
+#include "Core/JesterInitializationCheckpointSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "JesterToolboxStats.h"
+#include "JesterToolboxTrace.h"
+
+TRACE_DECLARE_INT_COUNTER(JesterPendingInitializationEvents, TEXT("JesterToolbox/PendingInitializationEvents"));
 
 
 // Sets default values for this component's properties
@@ -22,6 +30,43 @@ void UGameStateInitialization::BeginPlay()
 	Super::BeginPlay();
 	
 	InitializationIndex = 0;
+	SkipCheckpointedSteps();
+}
+
+void UGameStateInitialization::SkipCheckpointedSteps()
+{
+	const UGameInstance* GameInstance = GetWorld()->GetGameInstance();
+	UJesterInitializationCheckpointSubsystem* Checkpoint = GameInstance != nullptr ? GameInstance->GetSubsystem<UJesterInitializationCheckpointSubsystem>() : nullptr;
+	if (Checkpoint == nullptr)
+	{
+		return;
+	}
+
+	// Steps run in order, stop at the first one that has to run again
+	const FGameplayTagContainer CompletedSteps = Checkpoint->ConsumeCheckpoint(GetWorld());
+	while (OrderedInitializationSteps.IsValidIndex(InitializationIndex)
+		&& PersistentInitializationSteps.HasTagExact(OrderedInitializationSteps[InitializationIndex])
+		&& CompletedSteps.HasTagExact(OrderedInitializationSteps[InitializationIndex]))
+	{
+		UE_LOG(LogJesterToolbox, Log, TEXT("GameState Initialization Skipped: %s"), *OrderedInitializationSteps[InitializationIndex].ToString());
+		InitializationIndex++;
+	}
+
+	if (InitializationIndex == 0)
+	{
+		return;
+	}
+
+	JESTER_TRACE_BOOKMARK(TEXT("JesterToolbox: Skipped %d checkpointed initialization steps"), InitializationIndex);
+	if (OrderedInitializationSteps.IsValidIndex(InitializationIndex))
+	{
+		TriggerPendingEvents();
+		OnGameStateInitializationChanged.Broadcast(OrderedInitializationSteps[InitializationIndex]);
+	}
+	else
+	{
+		CompleteInitialization();
+	}
 }
 
 bool UGameStateInitialization::IsStateAlreadyInitialized(FGameplayTag State) const
@@ -41,6 +86,7 @@ bool UGameStateInitialization::IsCurrentState(FGameplayTag State) const
 void UGameStateInitialization::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	JESTER_TRACE_SCOPE("Jester::GameStateInitialization::Tick");
 
 	if(InitializationIndex >= OrderedInitializationSteps.Num())
 	{
@@ -50,50 +96,83 @@ void UGameStateInitialization::TickComponent(float DeltaTime, ELevelTick TickTyp
 	// Go through the initialization steps in order, only change steps once per frame
 	if(IsStepReadyToAdvance(OrderedInitializationSteps[InitializationIndex]))
 	{
-		UE_LOG(LogJesterToolbox, Log, TEXT("GameState Initialization Complete: %s"), *OrderedInitializationSteps[InitializationIndex].ToString());
+		const FGameplayTag CompletedStep = OrderedInitializationSteps[InitializationIndex];
+		UE_LOG(LogJesterToolbox, Log, TEXT("GameState Initialization Complete: %s"), *CompletedStep.ToString());
+		JESTER_TRACE_BOOKMARK(TEXT("JesterToolbox: Initialization step complete %s"), *CompletedStep.ToString());
 		InitializationIndex++;
-		if(OrderedInitializationSteps.IsValidIndex(InitializationIndex))
+
+		if(PersistentInitializationSteps.HasTagExact(CompletedStep))
 		{
-			TArray<int> TriggeredEvents;
-			// Call initialization events and clean them up
-			for(int i = 0; i < InitializationEvents.Num(); ++i)
+			const UGameInstance* GameInstance = GetWorld()->GetGameInstance();
+			if(UJesterInitializationCheckpointSubsystem* Checkpoint = GameInstance != nullptr ? GameInstance->GetSubsystem<UJesterInitializationCheckpointSubsystem>() : nullptr)
 			{
-				FGameStateInitializationEvent& Event = InitializationEvents[i];
-				const int EventStateIdx = OrderedInitializationSteps.Find(Event.State);
-				if(EventStateIdx == InitializationIndex && !Event.bIsPostState )
-				{
-					Event.Execute();
-					TriggeredEvents.Add(i);
-				}
-				else if(Event.bIsPostState && EventStateIdx < InitializationIndex)
-				{
-					Event.Execute();
-					TriggeredEvents.Add(i);
-				}
+				Checkpoint->RecordCompletedStep(GetWorld(), CompletedStep);
 			}
-			
-			for(int i = TriggeredEvents.Num() - 1; i >= 0; --i)
-			{
-				InitializationEvents.RemoveAt(TriggeredEvents[i]);
-			}
-			
+		}
+
+		if(OrderedInitializationSteps.IsValidIndex(InitializationIndex))
+		{
+			TriggerPendingEvents();
 			OnGameStateInitializationChanged.Broadcast(OrderedInitializationSteps[InitializationIndex]);
 		}
 		else
 		{
-			// Trigger last initialization events
-			for(FGameStateInitializationEvent& Event : InitializationEvents)
-			{
-				if(Event.State == OrderedInitializationSteps.Last())
-				{
-					Event.Execute();
-				}
-			}
-			OnGameStateFullyInitialized.Broadcast(FGameplayTag::EmptyTag);
-			// No more steps, disable ticking
-			SetComponentTickEnabled(false);
+			CompleteInitialization();
+		}
+	}
+}
+
+void UGameStateInitialization::TriggerPendingEvents()
+{
+	// Pre-state events of the current step, and every event of the steps before it. There can be more than one of those
+	// when steps were skipped through a checkpoint
+	const auto IsDue = [this](const FGameStateInitializationEvent& Event)
+	{
+		const int EventStateIdx = OrderedInitializationSteps.Find(Event.State);
+		return EventStateIdx != INDEX_NONE
+			&& (EventStateIdx < InitializationIndex || (EventStateIdx == InitializationIndex && !Event.bIsPostState));
+	};
+
+	TArray<FGameStateInitializationEvent> TriggeredEvents;
+	for(const FGameStateInitializationEvent& Event : InitializationEvents)
+	{
+		if(IsDue(Event))
+		{
+			TriggeredEvents.Add(Event);
+		}
+	}
+	// Removed before calling them, events can bind new ones
+	InitializationEvents.RemoveAll(IsDue);
+
+	// Step order, pre-state before post-state, then binding order
+	Algo::StableSortBy(TriggeredEvents, [this](const FGameStateInitializationEvent& Event)
+	{
+		return OrderedInitializationSteps.Find(Event.State) * 2 + (Event.bIsPostState ? 1 : 0);
+	});
+	for(FGameStateInitializationEvent& Event : TriggeredEvents)
+	{
+		Event.Execute();
+	}
+	JESTER_TRACE_COUNTER_SET(JesterPendingInitializationEvents, InitializationEvents.Num());
+	JESTER_STAT_SET(PendingInitializationEvents, InitializationEvents.Num());
+}
+
+void UGameStateInitialization::CompleteInitialization()
+{
+	// Trigger last initialization events, and the ones of steps skipped through a checkpoint
+	for(FGameStateInitializationEvent& Event : InitializationEvents)
+	{
+		if(OrderedInitializationSteps.Contains(Event.State))
+		{
+			Event.Execute();
 		}
 	}
+	InitializationEvents.Empty();
+	JESTER_TRACE_BOOKMARK(TEXT("JesterToolbox: GameState fully initialized"));
+	JESTER_STAT_SET(PendingInitializationEvents, 0);
+	OnGameStateFullyInitialized.Broadcast(FGameplayTag::EmptyTag);
+	// No more steps, disable ticking
+	SetComponentTickEnabled(false);
 }
 
 void UGameStateInitialization::BindToInitializationStep(FGameplayTag State, UObject* Object, FName FunctionName, bool bIsPostState)
@@ -105,4 +184,6 @@ void UGameStateInitialization::BindToInitializationStep(FGameplayTag State, UObj
 		return;
 	}
 	InitializationEvents.Add(NewEvent);
+	JESTER_TRACE_COUNTER_SET(JesterPendingInitializationEvents, InitializationEvents.Num());
+	JESTER_STAT_SET(PendingInitializationEvents, InitializationEvents.Num());
 }
\ No newline at end of file
@@ -0,0 +1,37 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/JesterAssetRef.h"
+
+#include "JesterToolbox.h"
+#include "Core/JesterAssetSubsystem.h"
+#include "Engine/Engine.h"
+
+void FJesterAssetRef::Resolve() const
+{
+	CachedAsset = nullptr;
+	if (!Tag.IsValid())
+	{
+		CachedGeneration = UAssetsLocatorService::GetGeneration();
+		return;
+	}
+
+	const UJesterAssetSubsystem* AssetSubsystem = GEngine != nullptr ? GEngine->GetEngineSubsystem<UJesterAssetSubsystem>() : nullptr;
+	const UAssetsLocatorService* Locator = AssetSubsystem != nullptr ? AssetSubsystem->GetAssetsLocatorService() : nullptr;
+	if (Locator == nullptr)
+	{
+		// Stamped so the error shows once, the locator bumps the generation when it initializes and the ref tries again
+		UE_LOG(LogJesterToolbox, Error, TEXT("Can't resolve asset %s, there is no AssetsLocatorService"), *Tag.ToString());
+		CachedGeneration = UAssetsLocatorService::GetGeneration();
+		return;
+	}
+
+	// Cached untyped, the same ref can be read with different classes
+	CachedAsset = Locator->GetAsset(Tag);
+	CachedGeneration = UAssetsLocatorService::GetGeneration();
+}
+
+void FJesterAssetRef::ReportUnexpectedClass(const UClass* ExpectedClass) const
+{
+	checkf(false, TEXT("Data asset with tag '%s' is not of expected type '%s'! Found: '%s'"),
+		*Tag.ToString(), *ExpectedClass->GetName(), *CachedAsset->GetName());
+}
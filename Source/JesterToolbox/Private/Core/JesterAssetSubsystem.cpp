@@ -2,11 +2,19 @@
 
 #include "Core/JesterAssetSubsystem.h"
 #include "JesterToolbox.h"
+#include "JesterToolboxMemory.h"
+#include "JesterToolboxStats.h"
 #include "Engine/DeveloperSettings.h"
 
 void UJesterAssetSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+	JESTER_LLM_SCOPE(Assets);
+
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(this, &UJesterAssetSubsystem::HandleObjectPropertyChanged);
+	FCoreUObjectDelegates::OnObjectsReplaced.AddUObject(this, &UJesterAssetSubsystem::HandleObjectsReplaced);
+#endif
 
 	// Try to get JesterToolboxSettings first
 	UClass* JesterSettingsClass = FindObject<UClass>(ANY_PACKAGE, TEXT("UJesterToolboxSettings"));
@@ -27,6 +35,7 @@ void UJesterAssetSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 					if (ServiceClassPtr && !ServiceClassPtr->IsNull())
 					{
+						JESTER_STAT_INC(AssetStreamingRequests);
 						TSubclassOf<UAssetsLocatorService> ClassToUse = ServiceClassPtr->LoadSynchronous();
 						if (ClassToUse)
 						{
@@ -34,6 +43,7 @@ void UJesterAssetSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 							if (AssetsLocatorService)
 							{
 								AssetsLocatorService->Initialize();
+								AssetsLocatorService->PublishSnapshot();
 								UE_LOG(LogJesterToolbox, Log, TEXT("JesterAssetSubsystem initialized AssetsLocatorService: %s"),
 									*ClassToUse->GetName());
 								return;
@@ -66,6 +76,7 @@ void UJesterAssetSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 						if (ServiceClassPtr && !ServiceClassPtr->IsNull())
 						{
+							JESTER_STAT_INC(AssetStreamingRequests);
 							TSubclassOf<UAssetsLocatorService> ClassToUse = ServiceClassPtr->LoadSynchronous();
 							if (ClassToUse)
 							{
@@ -73,6 +84,7 @@ void UJesterAssetSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 								if (AssetsLocatorService)
 								{
 									AssetsLocatorService->Initialize();
+									AssetsLocatorService->PublishSnapshot();
 									UE_LOG(LogJesterToolbox, Log, TEXT("JesterAssetSubsystem initialized AssetsLocatorService from %s: %s"),
 										*SettingsClass->GetName(), *ClassToUse->GetName());
 									return;
@@ -89,4 +101,55 @@ void UJesterAssetSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	{
 		UE_LOG(LogJesterToolbox, Warning, TEXT("JesterAssetSubsystem could not initialize AssetsLocatorService. Configure it in JesterToolboxSettings or project developer settings."));
 	}
-}
\ No newline at end of file
+}
+
+void UJesterAssetSubsystem::Deinitialize()
+{
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectPropertyChanged.RemoveAll(this);
+	FCoreUObjectDelegates::OnObjectsReplaced.RemoveAll(this);
+#endif
+	// The assets can go away with the service, don't let asset refs keep pointing to them
+	AssetsLocatorService = nullptr;
+	UAssetsLocatorService::BumpGeneration();
+	UAssetsLocatorService::ClearPublishedSnapshot();
+	Super::Deinitialize();
+}
+
+#if WITH_EDITOR
+void UJesterAssetSubsystem::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	// Designers edit the class defaults, the running service is an instance of that class
+	if (AssetsLocatorService != nullptr && Object != nullptr && Object->HasAnyFlags(RF_ClassDefaultObject)
+		&& AssetsLocatorService->GetClass()->IsChildOf(Object->GetClass()))
+	{
+		RefreshAssetsLocatorService();
+	}
+}
+
+void UJesterAssetSubsystem::HandleObjectsReplaced(const TMap<UObject*, UObject*>& ReplacedObjects)
+{
+	// A blueprint recompile reinstances the service, carry the flattened tables over and patch what changed
+	UObject* const* NewObject = ReplacedObjects.Find(AssetsLocatorService);
+	UAssetsLocatorService* NewService = NewObject != nullptr ? Cast<UAssetsLocatorService>(*NewObject) : nullptr;
+	if (NewService == nullptr)
+	{
+		return;
+	}
+
+	NewService->CopyFlattenedTables(*AssetsLocatorService);
+	AssetsLocatorService = NewService;
+	RefreshAssetsLocatorService();
+}
+
+void UJesterAssetSubsystem::RefreshAssetsLocatorService()
+{
+	// Only publish a new snapshot when the tables changed
+	const uint32 PreviousGeneration = UAssetsLocatorService::GetGeneration();
+	AssetsLocatorService->RefreshFromDefaults();
+	if (UAssetsLocatorService::GetGeneration() != PreviousGeneration)
+	{
+		AssetsLocatorService->PublishSnapshot();
+	}
+}
+#endif
\ No newline at end of file
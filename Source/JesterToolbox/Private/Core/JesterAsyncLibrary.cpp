@@ -0,0 +1,231 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/JesterAsyncLibrary.h"
+
+#include "Async/Async.h"
+#include "Core/GameStateInitialization.h"
+#include "Core/JesterAwaitable.h"
+#include "Core/JesterFunctionLibrary.h"
+#include "Engine/AssetManager.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "JesterToolbox.h"
+#include "JesterToolboxStats.h"
+#include "Tasks/Task.h"
+#include "TimerManager.h"
+
+UJesterAwaitable* UJesterAsyncLibrary::Delay(UObject* WorldContextObject, float Seconds)
+{
+	UJesterAwaitable* Awaitable = CreateAwaitable(WorldContextObject);
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+	if (World == nullptr)
+	{
+		Awaitable->Cancel();
+		return Awaitable;
+	}
+
+	const FTimerDelegate TimerDelegate = FTimerDelegate::CreateUObject(Awaitable, &UJesterAwaitable::CompleteFromEvent);
+	FTimerHandle TimerHandle;
+	if (Seconds > 0.0f)
+	{
+		World->GetTimerManager().SetTimer(TimerHandle, TimerDelegate, Seconds, false);
+	}
+	else
+	{
+		TimerHandle = World->GetTimerManager().SetTimerForNextTick(TimerDelegate);
+	}
+
+	Awaitable->SetCleanup([WeakWorld = TWeakObjectPtr<UWorld>(World), TimerHandle]() mutable
+	{
+		if (UWorld* World = WeakWorld.Get())
+		{
+			World->GetTimerManager().ClearTimer(TimerHandle);
+		}
+	});
+	return Awaitable;
+}
+
+UJesterAwaitable* UJesterAsyncLibrary::WaitForManager(UObject* WorldContextObject, TSubclassOf<UObject> ManagerClass)
+{
+	UJesterAwaitable* Awaitable = CreateAwaitable(WorldContextObject);
+	UManagerLocatorSubsystem* Locator = UJesterFunctionLibrary::GetManagerLocator();
+	if (Locator == nullptr || ManagerClass == nullptr)
+	{
+		Awaitable->Cancel();
+		return Awaitable;
+	}
+
+	if (UObject* Manager = Locator->FindManager(ManagerClass))
+	{
+		Awaitable->Complete(Manager);
+		return Awaitable;
+	}
+
+	const FDelegateHandle RegisteredHandle = Locator->OnManagerRegistered.AddWeakLambda(Awaitable, [Awaitable, ManagerClass](UObject* Manager)
+	{
+		if (Manager->GetClass()->IsChildOf(ManagerClass))
+		{
+			Awaitable->Complete(Manager);
+		}
+	});
+	Awaitable->SetCleanup([WeakLocator = TWeakObjectPtr<UManagerLocatorSubsystem>(Locator), RegisteredHandle]()
+	{
+		if (UManagerLocatorSubsystem* Locator = WeakLocator.Get())
+		{
+			Locator->OnManagerRegistered.Remove(RegisteredHandle);
+		}
+	});
+	return Awaitable;
+}
+
+UJesterAwaitable* UJesterAsyncLibrary::WaitForInitializationStep(UGameStateInitialization* Initialization, FGameplayTag Step, bool bIsPostState)
+{
+	UJesterAwaitable* Awaitable = CreateAwaitable(Initialization);
+	if (Initialization == nullptr)
+	{
+		Awaitable->Cancel();
+		return Awaitable;
+	}
+
+	// Completes right away when the step is already done
+	Initialization->BindToInitializationStep(Step, Awaitable, GET_FUNCTION_NAME_CHECKED(UJesterAwaitable, CompleteFromEvent), bIsPostState);
+	return Awaitable;
+}
+
+UJesterAwaitable* UJesterAsyncLibrary::LoadAsset(UObject* WorldContextObject, TSoftObjectPtr<UObject> Asset)
+{
+	return LoadAsync(WorldContextObject, Asset.ToSoftObjectPath());
+}
+
+UJesterAwaitable* UJesterAsyncLibrary::LoadClass(UObject* WorldContextObject, TSoftClassPtr<UObject> Class)
+{
+	return LoadAsync(WorldContextObject, Class.ToSoftObjectPath());
+}
+
+UJesterAwaitable* UJesterAsyncLibrary::LoadAssetBatch(UObject* WorldContextObject, const TArray<FSoftObjectPath>& Assets)
+{
+	UJesterAwaitable* Awaitable = CreateAwaitable(WorldContextObject);
+	TArray<FSoftObjectPath> PathsToLoad;
+	for (const FSoftObjectPath& Path : Assets)
+	{
+		if (!Path.IsNull() && Path.ResolveObject() == nullptr)
+		{
+			PathsToLoad.AddUnique(Path);
+		}
+	}
+
+	if (PathsToLoad.Num() == 0)
+	{
+		Awaitable->Complete();
+		return Awaitable;
+	}
+
+	JESTER_STAT_INC(AssetStreamingRequests);
+	TSharedPtr<FStreamableHandle> StreamableHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(PathsToLoad),
+		FStreamableDelegate::CreateWeakLambda(Awaitable, [Awaitable]()
+		{
+			Awaitable->Complete();
+		}));
+	// The handle is only needed while loading, whoever waits on the batch keeps hard references to what it uses
+	Awaitable->SetCleanup([StreamableHandle]()
+	{
+		if (StreamableHandle.IsValid() && StreamableHandle->IsLoadingInProgress())
+		{
+			StreamableHandle->CancelHandle();
+		}
+	});
+	return Awaitable;
+}
+
+UJesterAwaitable* UJesterAsyncLibrary::WhenAll(UObject* WorldContextObject, const TArray<UJesterAwaitable*>& Awaitables)
+{
+	UJesterAwaitable* Awaitable = CreateAwaitable(WorldContextObject);
+	TSharedRef<int32> NumRemaining = MakeShared<int32>(Awaitables.Num() + 1);
+	auto OnAwaitableCompleted = [Awaitable, NumRemaining](UJesterAwaitable*)
+	{
+		if (--(*NumRemaining) == 0)
+		{
+			Awaitable->Complete();
+		}
+	};
+
+	for (UJesterAwaitable* Each : Awaitables)
+	{
+		if (Each != nullptr)
+		{
+			Each->Then(OnAwaitableCompleted);
+			Each->OnCancelled([Awaitable](UJesterAwaitable*)
+			{
+				Awaitable->Cancel();
+			});
+		}
+		else
+		{
+			OnAwaitableCompleted(nullptr);
+		}
+	}
+	// Extra count so an array of already completed awaitables only completes once every Then was added
+	OnAwaitableCompleted(nullptr);
+	return Awaitable;
+}
+
+UJesterAwaitable* UJesterAsyncLibrary::RunOnWorkerThread(UObject* WorldContextObject, TFunction<void()>&& Work)
+{
+	UJesterAwaitable* Awaitable = CreateAwaitable(WorldContextObject);
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [Work = MoveTemp(Work), WeakAwaitable = TWeakObjectPtr<UJesterAwaitable>(Awaitable)]()
+	{
+		Work();
+		AsyncTask(ENamedThreads::GameThread, [WeakAwaitable]()
+		{
+			if (UJesterAwaitable* Awaitable = WeakAwaitable.Get())
+			{
+				Awaitable->Complete();
+			}
+		});
+	});
+	return Awaitable;
+}
+
+UJesterAwaitable* UJesterAsyncLibrary::CreateAwaitable(UObject* WorldContextObject)
+{
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	if (UJesterAsyncSubsystem* AsyncSubsystem = World != nullptr ? World->GetSubsystem<UJesterAsyncSubsystem>() : nullptr)
+	{
+		return AsyncSubsystem->CreateAwaitable();
+	}
+
+	UE_LOG(LogJesterToolbox, Warning, TEXT("No world for %s, the awaitable won't be kept alive while pending"), *GetNameSafe(WorldContextObject));
+	return NewObject<UJesterAwaitable>(GetTransientPackage());
+}
+
+UJesterAwaitable* UJesterAsyncLibrary::LoadAsync(UObject* WorldContextObject, const FSoftObjectPath& Path)
+{
+	UJesterAwaitable* Awaitable = CreateAwaitable(WorldContextObject);
+	if (Path.IsNull())
+	{
+		Awaitable->Complete();
+		return Awaitable;
+	}
+
+	if (UObject* LoadedObject = Path.ResolveObject())
+	{
+		Awaitable->Complete(LoadedObject);
+		return Awaitable;
+	}
+
+	JESTER_STAT_INC(AssetStreamingRequests);
+	TSharedPtr<FStreamableHandle> StreamableHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Path,
+		FStreamableDelegate::CreateWeakLambda(Awaitable, [Awaitable, Path]()
+		{
+			Awaitable->Complete(Path.ResolveObject());
+		}));
+	// The result keeps the asset alive once loaded, the handle is only needed while loading
+	Awaitable->SetCleanup([StreamableHandle]()
+	{
+		if (StreamableHandle.IsValid() && StreamableHandle->IsLoadingInProgress())
+		{
+			StreamableHandle->CancelHandle();
+		}
+	});
+	return Awaitable;
+}
@@ -0,0 +1,134 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/JesterAwaitable.h"
+
+UJesterAwaitable* UJesterAwaitable::Then(FJesterAwaitableContinuation Continuation)
+{
+	if (State == EJesterAwaitableState::Completed)
+	{
+		Continuation.ExecuteIfBound(this);
+	}
+	else if (State == EJesterAwaitableState::Pending)
+	{
+		Continuations.Add(Continuation);
+	}
+	return this;
+}
+
+UJesterAwaitable* UJesterAwaitable::Then(TFunction<void(UJesterAwaitable*)>&& Continuation)
+{
+	if (State == EJesterAwaitableState::Completed)
+	{
+		Continuation(this);
+	}
+	else if (State == EJesterAwaitableState::Pending)
+	{
+		NativeContinuations.Add(MoveTemp(Continuation));
+	}
+	return this;
+}
+
+UJesterAwaitable* UJesterAwaitable::OnCancelled(TFunction<void(UJesterAwaitable*)>&& Callback)
+{
+	if (State == EJesterAwaitableState::Cancelled)
+	{
+		Callback(this);
+	}
+	else if (State == EJesterAwaitableState::Pending)
+	{
+		CancelCallbacks.Add(MoveTemp(Callback));
+	}
+	return this;
+}
+
+void UJesterAwaitable::SetCleanup(TFunction<void()>&& InCleanup)
+{
+	if (IsDone())
+	{
+		InCleanup();
+		return;
+	}
+	Cleanup = MoveTemp(InCleanup);
+}
+
+void UJesterAwaitable::Complete(UObject* InResult)
+{
+	check(IsInGameThread());
+	if (IsDone())
+	{
+		return;
+	}
+
+	Result = InResult;
+	Finish(EJesterAwaitableState::Completed);
+	CancelCallbacks.Empty();
+
+	// Continuations can add more continuations or complete other awaitables, work on a copy
+	TArray<FJesterAwaitableContinuation> ContinuationsToRun = MoveTemp(Continuations);
+	TArray<TFunction<void(UJesterAwaitable*)>> NativeContinuationsToRun = MoveTemp(NativeContinuations);
+	for (TFunction<void(UJesterAwaitable*)>& Continuation : NativeContinuationsToRun)
+	{
+		Continuation(this);
+	}
+	for (const FJesterAwaitableContinuation& Continuation : ContinuationsToRun)
+	{
+		Continuation.ExecuteIfBound(this);
+	}
+}
+
+void UJesterAwaitable::Cancel()
+{
+	check(IsInGameThread());
+	if (IsDone())
+	{
+		return;
+	}
+
+	Finish(EJesterAwaitableState::Cancelled);
+	Continuations.Empty();
+	NativeContinuations.Empty();
+
+	TArray<TFunction<void(UJesterAwaitable*)>> CancelCallbacksToRun = MoveTemp(CancelCallbacks);
+	for (TFunction<void(UJesterAwaitable*)>& Callback : CancelCallbacksToRun)
+	{
+		Callback(this);
+	}
+}
+
+void UJesterAwaitable::CompleteFromEvent()
+{
+	Complete();
+}
+
+void UJesterAwaitable::Finish(EJesterAwaitableState NewState)
+{
+	State = NewState;
+	if (Cleanup)
+	{
+		TFunction<void()> CleanupToRun = MoveTemp(Cleanup);
+		CleanupToRun();
+	}
+
+	if (UJesterAsyncSubsystem* AsyncSubsystem = Cast<UJesterAsyncSubsystem>(GetOuter()))
+	{
+		AsyncSubsystem->PendingAwaitables.Remove(this);
+	}
+}
+
+UJesterAwaitable* UJesterAsyncSubsystem::CreateAwaitable()
+{
+	UJesterAwaitable* Awaitable = NewObject<UJesterAwaitable>(this);
+	PendingAwaitables.Add(Awaitable);
+	return Awaitable;
+}
+
+void UJesterAsyncSubsystem::Deinitialize()
+{
+	const TArray<UJesterAwaitable*> AwaitablesToCancel = PendingAwaitables.Array();
+	for (UJesterAwaitable* Awaitable : AwaitablesToCancel)
+	{
+		Awaitable->Cancel();
+	}
+	PendingAwaitables.Empty();
+	Super::Deinitialize();
+}
@@ -0,0 +1,18 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/JesterCapabilityLibrary.h"
+
+#include "Core/JesterObjectPoolSubsystem.h"
+#include "Engine/World.h"
+#include "JesterToolboxMemory.h"
+
+UObject* UJesterCapabilityLibrary::AcquireCapabilityObject(UObject* Outer, TSubclassOf<UObject> CapabilityClass)
+{
+	JESTER_LLM_SCOPE(Capabilities);
+	const UWorld* World = Outer != nullptr ? Outer->GetWorld() : nullptr;
+	if (UJesterObjectPoolSubsystem* Pool = World != nullptr ? World->GetSubsystem<UJesterObjectPoolSubsystem>() : nullptr)
+	{
+		return Pool->Acquire(CapabilityClass, Outer);
+	}
+	return NewObject<UObject>(Outer, CapabilityClass);
+}
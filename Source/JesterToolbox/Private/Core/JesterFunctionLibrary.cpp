@@ -7,8 +7,11 @@
 #include "AngelscriptManager.h"
 #include "GameplayTagContainer.h"
 #include "GameplayTagsManager.h"
+#include "JesterToolboxStats.h"
+#include "JesterToolboxTrace.h"
 #include "Animation/AnimMetaData.h"
 #include "Core/GameStateInitialization.h"
+#include "Core/JesterSpawnTemplateSubsystem.h"
 #include "Engine/SCS_Node.h"
 #include "Engine/SimpleConstructionScript.h"
 #include "GameFramework/GameStateBase.h"
@@ -18,6 +21,33 @@
 #include "Windows/WindowsPlatformApplicationMisc.h"
 #endif
 
+TRACE_DECLARE_INT_COUNTER(JesterSpawnedActors, TEXT("JesterToolbox/SpawnedActors"));
+TRACE_DECLARE_INT_COUNTER(JesterCopiedObjects, TEXT("JesterToolbox/CopiedObjects"));
+
+namespace
+{
+	// Explicit level first, then the script dynamic spawn level, then the level of whoever is spawning
+	ULevel* GetSpawnLevel(UWorld* World, UObject* WorldContext, ULevel* Level)
+	{
+		if (Level != nullptr)
+		{
+			return Level;
+		}
+		if (World->IsGameWorld() && FAngelscriptCodeModule::GetDynamicSpawnLevel().IsBound())
+		{
+			return FAngelscriptCodeModule::GetDynamicSpawnLevel().Execute();
+		}
+		if (auto* Comp = Cast<UActorComponent>(WorldContext))
+		{
+			return Comp->GetOwner() ? Comp->GetOwner()->GetLevel() : nullptr;
+		}
+		if (auto* Actor = Cast<AActor>(WorldContext))
+		{
+			return Actor->GetLevel();
+		}
+		return nullptr;
+	}
+}
 
 UManagerLocatorSubsystem* UJesterFunctionLibrary::GetManagerLocator()
 {
@@ -108,6 +138,7 @@ FVector UJesterFunctionLibrary::HitToDirection(FHitResult const& Hit)
 
 float UJesterFunctionLibrary::EvaluateFromRuntimeCurve(FRuntimeFloatCurve const& Curve, float Time)
 {
+	JESTER_TRACE_SCOPE("Jester::EvaluateFromRuntimeCurve");
 	return Curve.GetRichCurveConst()->Eval(Time);
 }
 
@@ -287,6 +318,10 @@ int UJesterFunctionLibrary::PickRandomIntInBounds(FInt32Range Bounds)
 
 AActor* UJesterFunctionLibrary::SpawnActor(const TSubclassOf<AActor>& ClassToSpawn, const FVector& Location, const FRotator& Rotation, ESpawnActorCollisionHandlingMethod SpawnActorCollisionHandling, const FName& Name, bool bDeferredSpawn, ULevel* Level)
 {
+	JESTER_TRACE_SCOPE("Jester::SpawnActor");
+	JESTER_TRACE_COUNTER_INCREMENT(JesterSpawnedActors);
+	JESTER_SCOPE_CYCLE_COUNTER(Spawn);
+	JESTER_STAT_INC(SpawnCalls);
 	UObject* WorldContext = FAngelscriptManager::CurrentWorldContext;
 	UWorld* World = GEngine->GetWorldFromContextObject(WorldContext, EGetWorldErrorMode::ReturnNull);
 	if (World == nullptr)
@@ -306,34 +341,49 @@ AActor* UJesterFunctionLibrary::SpawnActor(const TSubclassOf<AActor>& ClassToSpa
 	Params.NameMode = FActorSpawnParameters::ESpawnActorNameMode::Requested;
 	Params.bDeferConstruction = bDeferredSpawn;
 	Params.SpawnCollisionHandlingOverride = SpawnActorCollisionHandling;
+	Params.OverrideLevel = GetSpawnLevel(World, WorldContext, Level);
 
-	if (Level != nullptr)
-	{
-		Params.OverrideLevel = Level;
-	}
-	else if (World->IsGameWorld() && FAngelscriptCodeModule::GetDynamicSpawnLevel().IsBound())
+	return World->SpawnActor(ClassToSpawn, &Location, &Rotation, Params);
+}
+
+AActor* UJesterFunctionLibrary::SpawnActorFromTemplate(const TSubclassOf<AActor>& ClassToSpawn, const FVector& Location, const FRotator& Rotation, ULevel* Level)
+{
+	UObject* WorldContext = FAngelscriptManager::CurrentWorldContext;
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContext, EGetWorldErrorMode::ReturnNull);
+	UJesterSpawnTemplateSubsystem* SpawnTemplates = World != nullptr ? World->GetSubsystem<UJesterSpawnTemplateSubsystem>() : nullptr;
+	if (SpawnTemplates == nullptr)
 	{
-		Params.OverrideLevel = FAngelscriptCodeModule::GetDynamicSpawnLevel().Execute();
+		FAngelscriptManager::Throw("Invalid World Context");
+		return nullptr;
 	}
-	else if (auto* Comp = Cast<UActorComponent>(WorldContext))
+
+	if (ClassToSpawn == nullptr)
 	{
-		Params.OverrideLevel = Comp->GetOwner() ? Comp->GetOwner()->GetLevel() : nullptr;
+		FAngelscriptManager::Throw("Class was nullptr.");
+		return nullptr;
 	}
-	else if (auto* Actor = Cast<AActor>(WorldContext))
+
+	AActor* Actor = SpawnTemplates->SpawnFromTemplate(ClassToSpawn, FTransform(Rotation, Location), GetSpawnLevel(World, WorldContext, Level));
+	if (Actor != nullptr)
 	{
-		Params.OverrideLevel = Actor->GetLevel();
+		JESTER_TRACE_COUNTER_INCREMENT(JesterSpawnedActors);
 	}
-
-	return World->SpawnActor(ClassToSpawn, &Location, &Rotation, Params);
+	return Actor;
 }
 
 AActor* UJesterFunctionLibrary::FinishSpawningActor(AActor* Actor, FTransform Transform, ESpawnActorScaleMethod ScaleMethod)
 {
+	JESTER_TRACE_SCOPE("Jester::FinishSpawningActor");
+	JESTER_SCOPE_CYCLE_COUNTER(Spawn);
 	return UGameplayStatics::FinishSpawningActor(Actor, Transform, ScaleMethod);
 }
 
 UObject* UJesterFunctionLibrary::CopyObject(UObject* ToCopy)
 {
+	JESTER_TRACE_SCOPE("Jester::CopyObject");
+	JESTER_TRACE_COUNTER_INCREMENT(JesterCopiedObjects);
+	JESTER_SCOPE_CYCLE_COUNTER(CopyObject);
+	JESTER_STAT_INC(CopyObjectCalls);
 	if(ToCopy == nullptr)
 	{
 		return nullptr;
@@ -344,6 +394,10 @@ UObject* UJesterFunctionLibrary::CopyObject(UObject* ToCopy)
 
 void UJesterFunctionLibrary::CopyObjectTo(UObject* Source, UObject* Destination)
 {
+	JESTER_TRACE_SCOPE("Jester::CopyObjectTo");
+	JESTER_TRACE_COUNTER_INCREMENT(JesterCopiedObjects);
+	JESTER_SCOPE_CYCLE_COUNTER(CopyObject);
+	JESTER_STAT_INC(CopyObjectCalls);
 	if(Source == nullptr || Destination == nullptr)
 	{
 		return;
@@ -0,0 +1,59 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/JesterInitializationCheckpointSubsystem.h"
+
+#include "Engine/World.h"
+#include "JesterToolbox.h"
+
+void UJesterInitializationCheckpointSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	FWorldDelegates::OnSeamlessTravelStart.AddWeakLambda(this, [this](UWorld* World, const FString&) { HandleSeamlessTravel(World); });
+	FWorldDelegates::OnSeamlessTravelTransition.AddUObject(this, &UJesterInitializationCheckpointSubsystem::HandleSeamlessTravel);
+}
+
+void UJesterInitializationCheckpointSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnSeamlessTravelStart.RemoveAll(this);
+	FWorldDelegates::OnSeamlessTravelTransition.RemoveAll(this);
+	Super::Deinitialize();
+}
+
+void UJesterInitializationCheckpointSubsystem::RecordCompletedStep(const UWorld* World, FGameplayTag Step)
+{
+	if (CheckpointWorld.Get() != World)
+	{
+		CompletedSteps.Reset();
+		CheckpointWorld = World;
+	}
+	CompletedSteps.AddTag(Step);
+}
+
+FGameplayTagContainer UJesterInitializationCheckpointSubsystem::ConsumeCheckpoint(const UWorld* World)
+{
+	if (CheckpointWorld.Get() != World)
+	{
+		if (!bSeamlessTravelPending && !CompletedSteps.IsEmpty())
+		{
+			UE_LOG(LogJesterToolbox, Log, TEXT("Dropped the initialization checkpoint, %s wasn't reached through seamless travel"), *GetNameSafe(World));
+			CompletedSteps.Reset();
+		}
+		CheckpointWorld = World;
+	}
+	bSeamlessTravelPending = false;
+	return CompletedSteps;
+}
+
+void UJesterInitializationCheckpointSubsystem::ClearCheckpoint()
+{
+	CompletedSteps.Reset();
+}
+
+void UJesterInitializationCheckpointSubsystem::HandleSeamlessTravel(UWorld* World)
+{
+	// Other game instances travel on their own, in PIE for instance
+	if (World != nullptr && World->GetGameInstance() == GetGameInstance())
+	{
+		bSeamlessTravelPending = true;
+	}
+}
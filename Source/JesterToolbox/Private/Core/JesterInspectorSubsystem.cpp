@@ -0,0 +1,396 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/JesterInspectorSubsystem.h"
+
+#include "JesterToolbox.h"
+
+#if !UE_BUILD_SHIPPING
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HttpPath.h"
+#include "HttpServerModule.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "IHttpRouter.h"
+#include "JsonObjectConverter.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Subsystems/Subsystem.h"
+#include "UObject/UnrealType.h"
+#include "UObject/UObjectIterator.h"
+
+namespace
+{
+	constexpr int32 MaxObjectsPerRequest = 32;
+	constexpr int32 MaxSubobjectsPerActor = 256;
+
+	const TCHAR* ViewerPage = TEXT(R"(<!DOCTYPE html>
+<html><head><title>Jester Inspector</title>
+<style>body{font-family:monospace;display:flex;margin:0}#list{width:30%;height:100vh;overflow:auto}#details{flex:1;height:100vh;overflow:auto;white-space:pre}div.actor{cursor:pointer}div.actor:hover{background:#ddd}</style>
+</head><body>
+<div id="list"><input id="filter" placeholder="class filter" onchange="loadActors()"><button onclick="loadActors()">Refresh</button><div id="actors"></div></div>
+<div id="details"></div>
+<script>
+async function loadActors() {
+	const response = await fetch('/jester/actors?class=' + encodeURIComponent(document.getElementById('filter').value));
+	const worlds = (await response.json()).Worlds;
+	const actors = document.getElementById('actors');
+	actors.innerHTML = '';
+	for (const world of worlds) {
+		for (const actor of world.Actors) {
+			const row = document.createElement('div');
+			row.className = 'actor';
+			row.textContent = world.Name + ' / ' + actor.Name;
+			row.onclick = async () => {
+				const details = await fetch('/jester/actor?name=' + encodeURIComponent(actor.Name));
+				document.getElementById('details').textContent = JSON.stringify(await details.json(), null, 2);
+			};
+			actors.appendChild(row);
+		}
+	}
+}
+loadActors();
+</script></body></html>)");
+
+	FString ToJsonString(const TSharedRef<FJsonObject>& Json)
+	{
+		// Condensed, the viewer formats it
+		FString Output;
+		const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Output);
+		FJsonSerializer::Serialize(Json, Writer);
+		return Output;
+	}
+
+	TSharedRef<FJsonObject> MakeObjectJson(const UObject* Object)
+	{
+		TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+		Json->SetStringField(TEXT("Name"), Object->GetName());
+		Json->SetStringField(TEXT("Class"), Object->GetClass()->GetName());
+
+		// Same data the ImGui windows read, through reflection so script classes come for free
+		TSharedRef<FJsonObject> Properties = MakeShared<FJsonObject>();
+		FJsonObjectConverter::UStructToJsonObject(Object->GetClass(), Object, Properties, 0, CPF_Deprecated);
+		Json->SetObjectField(TEXT("Properties"), Properties);
+		return Json;
+	}
+
+	// Runtime objects that belong to whoever points to them, pooled ones included whatever their outer is
+	bool IsInstanceData(const UObject* Object)
+	{
+		return Object != nullptr
+			&& !Object->HasAnyFlags(RF_Public | RF_ClassDefaultObject | RF_ArchetypeObject)
+			&& !Object->IsA<AActor>()
+			&& !Object->IsA<UActorComponent>()
+			&& !Object->IsA<USubsystem>()
+			&& !Object->IsA<UWorld>()
+			&& !Object->IsA<ULevel>();
+	}
+
+	// The capability tree and the like aren't default subobjects, follow the object properties of the actor and its
+	// components instead, breadth first
+	TArray<const UObject*> GatherInstanceSubobjects(const AActor& Actor)
+	{
+		TArray<const UObject*> Pending;
+		Pending.Add(&Actor);
+		for (const UActorComponent* Component : Actor.GetComponents())
+		{
+			Pending.Add(Component);
+		}
+		TSet<const UObject*> Visited;
+		Visited.Append(Pending);
+
+		TArray<const UObject*> Subobjects;
+		for (int32 i = 0; i < Pending.Num() && Subobjects.Num() < MaxSubobjectsPerActor; ++i)
+		{
+			for (TPropertyValueIterator<FObjectPropertyBase> It(Pending[i]->GetClass(), Pending[i]); It; ++It)
+			{
+				const UObject* Referenced = It.Key()->GetObjectPropertyValue(It.Value());
+				if (IsInstanceData(Referenced) && !Visited.Contains(Referenced))
+				{
+					Visited.Add(Referenced);
+					Pending.Add(Referenced);
+					Subobjects.Add(Referenced);
+				}
+			}
+		}
+		return Subobjects;
+	}
+
+	template<typename TPredicate>
+	void ForEachGameWorld(TPredicate Predicate)
+	{
+		for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+		{
+			if (UWorld* World = WorldContext.World(); World != nullptr && World->IsGameWorld())
+			{
+				Predicate(*World);
+			}
+		}
+	}
+
+	const FString* FindQueryParam(const FHttpServerRequest& Request, const TCHAR* Name)
+	{
+		return Request.QueryParams.Find(Name);
+	}
+}
+
+class FJesterInspectorServer
+{
+public:
+	~FJesterInspectorServer()
+	{
+		if (Router.IsValid())
+		{
+			for (const FHttpRouteHandle& RouteHandle : RouteHandles)
+			{
+				Router->UnbindRoute(RouteHandle);
+			}
+		}
+	}
+
+	bool Start(uint32 Port)
+	{
+		// Loopback unless the project configured this port itself, the data isn't meant to leave the machine. The
+		// http server only takes bind addresses from the config: the override is limited to this port and removed once
+		// the listener is up, the default bind address of the other listeners is left alone
+		const TCHAR* ListenersSection = TEXT("HTTPServer.Listeners");
+		TArray<FString> ListenerOverrides;
+		const bool bHasOverrides = GConfig->GetArray(ListenersSection, TEXT("ListenerOverrides"), ListenerOverrides, GEngineIni) > 0;
+		const bool bPortConfigured = ListenerOverrides.ContainsByPredicate([Port](const FString& Override)
+		{
+			uint32 OverridePort = 0;
+			return FParse::Value(*Override, TEXT("Port="), OverridePort) && OverridePort == Port;
+		});
+		if (!bPortConfigured)
+		{
+			TArray<FString> InspectorOverrides = ListenerOverrides;
+			InspectorOverrides.Add(FString::Printf(TEXT("(Port=%u,BindAddress=127.0.0.1)"), Port));
+			GConfig->SetArray(ListenersSection, TEXT("ListenerOverrides"), InspectorOverrides, GEngineIni);
+		}
+
+		Router = FHttpServerModule::Get().GetHttpRouter(Port, /* bFailOnBindFailure */ true);
+		if (Router.IsValid())
+		{
+			Bind(TEXT("/jester"), &FJesterInspectorServer::HandleViewer);
+			Bind(TEXT("/jester/actors"), &FJesterInspectorServer::HandleActors);
+			Bind(TEXT("/jester/actor"), &FJesterInspectorServer::HandleActor);
+			Bind(TEXT("/jester/objects"), &FJesterInspectorServer::HandleObjects);
+			FHttpServerModule::Get().StartAllListeners();
+		}
+
+		if (!bPortConfigured && bHasOverrides)
+		{
+			GConfig->SetArray(ListenersSection, TEXT("ListenerOverrides"), ListenerOverrides, GEngineIni);
+		}
+		else if (!bPortConfigured)
+		{
+			GConfig->RemoveKey(ListenersSection, TEXT("ListenerOverrides"), GEngineIni);
+		}
+
+		if (!Router.IsValid())
+		{
+			UE_LOG(LogJesterToolbox, Error, TEXT("Jester inspector could not listen on port %u"), Port);
+			return false;
+		}
+		UE_LOG(LogJesterToolbox, Display, TEXT("Jester inspector listening on http://localhost:%u/jester"), Port);
+		return true;
+	}
+
+private:
+	using FHandler = TUniquePtr<FHttpServerResponse> (FJesterInspectorServer::*)(const FHttpServerRequest&);
+
+	void Bind(const TCHAR* Path, FHandler Handler)
+	{
+		RouteHandles.Add(Router->BindRoute(FHttpPath(Path), EHttpServerRequestVerbs::VERB_GET,
+			FHttpRequestHandler::CreateLambda([this, Handler](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+			{
+				// Routes are handled on the game thread, the world can be read directly
+				OnComplete((this->*Handler)(Request));
+				return true;
+			})));
+	}
+
+	TUniquePtr<FHttpServerResponse> HandleViewer(const FHttpServerRequest& Request)
+	{
+		return FHttpServerResponse::Create(ViewerPage, TEXT("text/html"));
+	}
+
+	TUniquePtr<FHttpServerResponse> HandleActors(const FHttpServerRequest& Request)
+	{
+		const FString* ClassFilter = FindQueryParam(Request, TEXT("class"));
+
+		TArray<TSharedPtr<FJsonValue>> WorldsJson;
+		ForEachGameWorld([&WorldsJson, ClassFilter](UWorld& World)
+		{
+			TArray<TSharedPtr<FJsonValue>> ActorsJson;
+			for (TActorIterator<AActor> It(&World); It; ++It)
+			{
+				const AActor* Actor = *It;
+				if (ClassFilter != nullptr && !ClassFilter->IsEmpty() && !Actor->GetClass()->GetName().Contains(*ClassFilter))
+				{
+					continue;
+				}
+
+				TSharedRef<FJsonObject> ActorJson = MakeShared<FJsonObject>();
+				ActorJson->SetStringField(TEXT("Name"), Actor->GetName());
+				ActorJson->SetStringField(TEXT("Class"), Actor->GetClass()->GetName());
+				ActorJson->SetStringField(TEXT("Location"), Actor->GetActorLocation().ToCompactString());
+				TArray<TSharedPtr<FJsonValue>> ComponentsJson;
+				for (const UActorComponent* Component : Actor->GetComponents())
+				{
+					ComponentsJson.Add(MakeShared<FJsonValueString>(Component->GetName()));
+				}
+				ActorJson->SetArrayField(TEXT("Components"), ComponentsJson);
+				ActorsJson.Add(MakeShared<FJsonValueObject>(ActorJson));
+			}
+
+			TSharedRef<FJsonObject> WorldJson = MakeShared<FJsonObject>();
+			WorldJson->SetStringField(TEXT("Name"), World.GetName());
+			WorldJson->SetNumberField(TEXT("Time"), World.GetTimeSeconds());
+			WorldJson->SetArrayField(TEXT("Actors"), ActorsJson);
+			WorldsJson.Add(MakeShared<FJsonValueObject>(WorldJson));
+		});
+
+		TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+		Json->SetArrayField(TEXT("Worlds"), WorldsJson);
+		return FHttpServerResponse::Create(ToJsonString(Json), TEXT("application/json"));
+	}
+
+	TUniquePtr<FHttpServerResponse> HandleActor(const FHttpServerRequest& Request)
+	{
+		const FString* Name = FindQueryParam(Request, TEXT("name"));
+		if (Name == nullptr)
+		{
+			return FHttpServerResponse::Error(EHttpServerResponseCodes::BadRequest, TEXT("MissingName"), TEXT("?name= is required"));
+		}
+
+		TSharedPtr<FJsonObject> Json;
+		ForEachGameWorld([&Json, Name](UWorld& World)
+		{
+			for (TActorIterator<AActor> It(&World); It && !Json.IsValid(); ++It)
+			{
+				if (It->GetName() != *Name)
+				{
+					continue;
+				}
+
+				Json = MakeObjectJson(*It);
+				TArray<TSharedPtr<FJsonValue>> ComponentsJson;
+				for (const UActorComponent* Component : It->GetComponents())
+				{
+					ComponentsJson.Add(MakeShared<FJsonValueObject>(MakeObjectJson(Component)));
+				}
+				Json->SetArrayField(TEXT("Components"), ComponentsJson);
+
+				TArray<TSharedPtr<FJsonValue>> SubobjectsJson;
+				for (const UObject* Subobject : GatherInstanceSubobjects(**It))
+				{
+					TSharedRef<FJsonObject> SubobjectJson = MakeObjectJson(Subobject);
+					SubobjectJson->SetStringField(TEXT("Outer"), GetNameSafe(Subobject->GetOuter()));
+					SubobjectsJson.Add(MakeShared<FJsonValueObject>(SubobjectJson));
+				}
+				Json->SetArrayField(TEXT("Subobjects"), SubobjectsJson);
+			}
+		});
+
+		if (!Json.IsValid())
+		{
+			return FHttpServerResponse::Error(EHttpServerResponseCodes::NotFound, TEXT("ActorNotFound"), *Name);
+		}
+		return FHttpServerResponse::Create(ToJsonString(Json.ToSharedRef()), TEXT("application/json"));
+	}
+
+	TUniquePtr<FHttpServerResponse> HandleObjects(const FHttpServerRequest& Request)
+	{
+		const FString* ClassName = FindQueryParam(Request, TEXT("class"));
+		const UClass* Class = ClassName != nullptr ? FindObject<UClass>(ANY_PACKAGE, **ClassName) : nullptr;
+		if (Class == nullptr)
+		{
+			return FHttpServerResponse::Error(EHttpServerResponseCodes::NotFound, TEXT("ClassNotFound"), ClassName != nullptr ? **ClassName : TEXT("?class= is required"));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> ObjectsJson;
+		for (TObjectIterator<UObject> It(RF_ClassDefaultObject | RF_ArchetypeObject); It && ObjectsJson.Num() < MaxObjectsPerRequest; ++It)
+		{
+			if (It->IsA(Class))
+			{
+				ObjectsJson.Add(MakeShared<FJsonValueObject>(MakeObjectJson(*It)));
+			}
+		}
+
+		TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+		Json->SetArrayField(TEXT("Objects"), ObjectsJson);
+		return FHttpServerResponse::Create(ToJsonString(Json), TEXT("application/json"));
+	}
+
+	TSharedPtr<IHttpRouter> Router;
+	TArray<FHttpRouteHandle> RouteHandles;
+};
+
+namespace
+{
+	void StartInspectorCommand(const TArray<FString>& Args)
+	{
+		const uint32 Port = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 8090;
+		GEngine->GetEngineSubsystem<UJesterInspectorSubsystem>()->StartInspector(Port);
+	}
+
+	static FAutoConsoleCommand StartCommand(
+		TEXT("Jester.Inspector.Start"),
+		TEXT("Serves the toolbox debug data as JSON on localhost. Usage: Jester.Inspector.Start [Port=8090]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&StartInspectorCommand));
+
+	static FAutoConsoleCommand StopCommand(
+		TEXT("Jester.Inspector.Stop"),
+		TEXT("Stops the Jester inspector"),
+		FConsoleCommandDelegate::CreateLambda([]() { GEngine->GetEngineSubsystem<UJesterInspectorSubsystem>()->StopInspector(); }));
+}
+#else
+class FJesterInspectorServer
+{
+};
+#endif
+
+void UJesterInspectorSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	uint32 Port = 0;
+	if (FParse::Value(FCommandLine::Get(), TEXT("JesterInspectorPort="), Port) && Port != 0)
+	{
+		StartInspector(Port);
+	}
+}
+
+void UJesterInspectorSubsystem::Deinitialize()
+{
+	StopInspector();
+	Super::Deinitialize();
+}
+
+bool UJesterInspectorSubsystem::StartInspector(uint32 Port)
+{
+#if !UE_BUILD_SHIPPING
+	StopInspector();
+	TSharedPtr<FJesterInspectorServer> NewServer = MakeShared<FJesterInspectorServer>();
+	if (NewServer->Start(Port))
+	{
+		Server = NewServer;
+		return true;
+	}
+#endif
+	return false;
+}
+
+void UJesterInspectorSubsystem::StopInspector()
+{
+	Server.Reset();
+}
+
+bool UJesterInspectorSubsystem::IsRunning() const
+{
+	return Server.IsValid();
+}
@@ -0,0 +1,15 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/JesterMemoryLibrary.h"
+
+#include "JesterToolboxMemory.h"
+
+void UJesterMemoryLibrary::EnterToolboxScope()
+{
+	JesterMemory::EnterToolboxScope();
+}
+
+void UJesterMemoryLibrary::LeaveToolboxScope()
+{
+	JesterMemory::LeaveToolboxScope();
+}
@@ -0,0 +1,152 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/JesterObjectPoolSubsystem.h"
+
+#include "JesterToolbox.h"
+#include "JesterToolboxTrace.h"
+
+namespace
+{
+	constexpr ERenameFlags PoolRenameFlags = REN_DontCreateRedirectors | REN_DoNotDirty | REN_NonTransactional | REN_ForceNoResetLoaders;
+
+	// Copies every property from the class default object, so nothing the previous user left (cached references,
+	// timers, counters) reaches the next one. Instanced references are left alone, they would end up shared with the CDO
+	void ResetToClassDefaults(UObject* Object)
+	{
+		const UObject* DefaultObject = Object->GetClass()->GetDefaultObject();
+		for (TFieldIterator<FProperty> It(Object->GetClass()); It; ++It)
+		{
+			const FProperty* Property = *It;
+			if (!Property->HasAnyPropertyFlags(CPF_InstancedReference | CPF_ContainsInstancedReference))
+			{
+				Property->CopyCompleteValue_InContainer(Object, DefaultObject);
+			}
+		}
+	}
+}
+
+UObject* UJesterObjectPoolSubsystem::Acquire(TSubclassOf<UObject> ObjectClass, UObject* Outer)
+{
+	JESTER_TRACE_SCOPE("Jester::ObjectPool::Acquire");
+	if (ObjectClass == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (Outer == nullptr)
+	{
+		Outer = this;
+	}
+
+	if (FJesterObjectPool* Pool = Pools.Find(ObjectClass))
+	{
+		while (Pool->FreeObjects.Num() > 0)
+		{
+			UObject* Object = Pool->FreeObjects.Pop(false);
+			if (!IsValid(Object))
+			{
+				continue;
+			}
+
+			if (Object->GetOuter() != Outer)
+			{
+				Object->Rename(nullptr, Outer, PoolRenameFlags);
+			}
+			if (Object->Implements<UJesterPoolable>())
+			{
+				IJesterPoolable::Execute_OnAcquiredFromPool(Object);
+			}
+			return Object;
+		}
+	}
+
+	return NewObject<UObject>(Outer, ObjectClass);
+}
+
+void UJesterObjectPoolSubsystem::Release(UObject* Object)
+{
+	if (!IsValid(Object))
+	{
+		return;
+	}
+
+	FJesterObjectPool& Pool = Pools.FindOrAdd(Object->GetClass());
+#if !UE_BUILD_SHIPPING
+	if (Pool.FreeObjects.Contains(Object))
+	{
+		UE_LOG(LogJesterToolbox, Error, TEXT("%s was released to the object pool twice!"), *Object->GetName());
+		return;
+	}
+#endif
+
+	if (Object->Implements<UJesterPoolable>())
+	{
+		IJesterPoolable::Execute_OnReturnedToPool(Object);
+	}
+
+	if (Pool.FreeObjects.Num() >= GetMaxPooledObjects(Pool))
+	{
+		return;
+	}
+	ResetToClassDefaults(Object);
+
+	// Don't keep the previous outer alive, it's usually about to be destroyed
+	if (Object->GetOuter() != this)
+	{
+		Object->Rename(nullptr, this, PoolRenameFlags);
+	}
+	Pool.FreeObjects.Add(Object);
+}
+
+void UJesterObjectPoolSubsystem::Prewarm(TSubclassOf<UObject> ObjectClass, int32 Count)
+{
+	if (ObjectClass == nullptr)
+	{
+		return;
+	}
+
+	JESTER_TRACE_SCOPE("Jester::ObjectPool::Prewarm");
+	FJesterObjectPool& Pool = Pools.FindOrAdd(ObjectClass);
+	Count = FMath::Min(Count, GetMaxPooledObjects(Pool));
+	Pool.FreeObjects.Reserve(Count);
+	while (Pool.FreeObjects.Num() < Count)
+	{
+		Pool.FreeObjects.Add(NewObject<UObject>(this, ObjectClass));
+	}
+}
+
+void UJesterObjectPoolSubsystem::SetMaxPooledObjects(TSubclassOf<UObject> ObjectClass, int32 MaxPooledObjects)
+{
+	if (ObjectClass == nullptr)
+	{
+		return;
+	}
+
+	FJesterObjectPool& Pool = Pools.FindOrAdd(ObjectClass);
+	Pool.MaxPooledObjects = MaxPooledObjects;
+	if (Pool.FreeObjects.Num() > GetMaxPooledObjects(Pool))
+	{
+		Pool.FreeObjects.SetNum(GetMaxPooledObjects(Pool));
+	}
+}
+
+int32 UJesterObjectPoolSubsystem::GetNumPooledObjects(TSubclassOf<UObject> ObjectClass) const
+{
+	const FJesterObjectPool* Pool = Pools.Find(ObjectClass);
+	return Pool != nullptr ? Pool->FreeObjects.Num() : 0;
+}
+
+void UJesterObjectPoolSubsystem::EmptyPools()
+{
+	Pools.Empty();
+}
+
+bool UJesterObjectPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+int32 UJesterObjectPoolSubsystem::GetMaxPooledObjects(const FJesterObjectPool& Pool) const
+{
+	return Pool.MaxPooledObjects != INDEX_NONE ? Pool.MaxPooledObjects : DefaultMaxPooledObjects;
+}
@@ -0,0 +1,195 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/JesterParallelLibrary.h"
+
+#include "Async/ParallelFor.h"
+#include "Core/JesterAsyncLibrary.h"
+#include "Core/JesterAwaitable.h"
+#include "HAL/IConsoleManager.h"
+#include "JesterToolbox.h"
+#include "JesterToolboxTrace.h"
+#include "Serialization/ObjectWriter.h"
+
+namespace
+{
+	bool GAllowScriptWorkers = true;
+	FAutoConsoleVariableRef CVarAllowScriptWorkers(
+		TEXT("Jester.Parallel.AllowWorkers"),
+		GAllowScriptWorkers,
+		TEXT("When false, JesterParallel kernels run on the game thread"));
+
+	thread_local bool GIsInWorkerKernel = false;
+
+	struct FWorkerKernelScope
+	{
+		FWorkerKernelScope() { GIsInWorkerKernel = !IsInGameThread(); }
+		~FWorkerKernelScope() { GIsInWorkerKernel = false; }
+	};
+
+#if !UE_BUILD_SHIPPING
+	// Kernels have to leave their object alone, compares its serialized properties before and after running them
+	class FMutationCheck
+	{
+	public:
+		explicit FMutationCheck(UObject* InObject)
+			: Object(InObject)
+		{
+			if (Object != nullptr)
+			{
+				FObjectWriter Writer(Object, BytesBefore);
+			}
+		}
+
+		~FMutationCheck()
+		{
+			if (Object == nullptr)
+			{
+				return;
+			}
+
+			TArray<uint8> BytesAfter;
+			FObjectWriter Writer(Object, BytesAfter);
+			ensureMsgf(BytesBefore == BytesAfter, TEXT("%s was modified by a JesterParallel kernel, kernels run on worker threads and must not write to UObjects"),
+				*Object->GetName());
+		}
+
+	private:
+		UObject* Object = nullptr;
+		TArray<uint8> BytesBefore;
+	};
+#endif
+}
+
+template<typename TDelegate, typename TKernel>
+void UJesterParallelLibrary::RunKernel(int32 Num, const TDelegate& Body, TKernel Kernel)
+{
+	const bool bSingleThreaded = !CanRunOnWorkers(Body.GetUObject(), Body.GetFunctionName());
+#if !UE_BUILD_SHIPPING
+	FMutationCheck MutationCheck(bSingleThreaded ? nullptr : Body.GetUObject());
+#endif
+	::ParallelFor(Num, [&Kernel](int32 Index)
+	{
+		FWorkerKernelScope KernelScope;
+		Kernel(Index);
+	}, bSingleThreaded ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+void UJesterParallelLibrary::ParallelFor(int32 Num, FJesterParallelForBody Body)
+{
+	JESTER_TRACE_SCOPE("Jester::ParallelFor");
+	if (!Body.IsBound() || Num <= 0)
+	{
+		return;
+	}
+
+	RunKernel(Num, Body, [&Body](int32 Index)
+	{
+		Body.Execute(Index);
+	});
+}
+
+void UJesterParallelLibrary::ParallelForFloat(int32 Num, FJesterParallelForFloatBody Body, TArray<float>& OutResults)
+{
+	JESTER_TRACE_SCOPE("Jester::ParallelForFloat");
+	if (!Body.IsBound() || Num <= 0)
+	{
+		OutResults.Reset();
+		return;
+	}
+
+	// Every index writes its own element of a local array, OutResults may be a member of the bound object
+	// and is only assigned once the mutation check is done
+	TArray<float> Results;
+	Results.SetNumUninitialized(Num);
+	float* ResultData = Results.GetData();
+	RunKernel(Num, Body, [&Body, ResultData](int32 Index)
+	{
+		ResultData[Index] = Body.Execute(Index);
+	});
+	OutResults = MoveTemp(Results);
+}
+
+void UJesterParallelLibrary::ParallelForInt(int32 Num, FJesterParallelForIntBody Body, TArray<int32>& OutResults)
+{
+	JESTER_TRACE_SCOPE("Jester::ParallelForInt");
+	if (!Body.IsBound() || Num <= 0)
+	{
+		OutResults.Reset();
+		return;
+	}
+
+	TArray<int32> Results;
+	Results.SetNumUninitialized(Num);
+	int32* ResultData = Results.GetData();
+	RunKernel(Num, Body, [&Body, ResultData](int32 Index)
+	{
+		ResultData[Index] = Body.Execute(Index);
+	});
+	OutResults = MoveTemp(Results);
+}
+
+void UJesterParallelLibrary::ParallelForVector(int32 Num, FJesterParallelForVectorBody Body, TArray<FVector>& OutResults)
+{
+	JESTER_TRACE_SCOPE("Jester::ParallelForVector");
+	if (!Body.IsBound() || Num <= 0)
+	{
+		OutResults.Reset();
+		return;
+	}
+
+	TArray<FVector> Results;
+	Results.SetNumUninitialized(Num);
+	FVector* ResultData = Results.GetData();
+	RunKernel(Num, Body, [&Body, ResultData](int32 Index)
+	{
+		ResultData[Index] = Body.Execute(Index);
+	});
+	OutResults = MoveTemp(Results);
+}
+
+UJesterAwaitable* UJesterParallelLibrary::SpawnTask(UObject* WorldContextObject, FJesterTaskBody Body)
+{
+	if (!CanRunOnWorkers(Body.GetUObject(), Body.GetFunctionName()))
+	{
+		Body.ExecuteIfBound();
+		// Still complete on a later frame, callers shouldn't depend on where the body ran
+		return UJesterAsyncLibrary::Delay(WorldContextObject, 0.0f);
+	}
+
+	return UJesterAsyncLibrary::RunOnWorkerThread(WorldContextObject, [Body]()
+	{
+		JESTER_TRACE_SCOPE("Jester::SpawnTask");
+		FWorkerKernelScope KernelScope;
+		Body.ExecuteIfBound();
+	});
+}
+
+bool UJesterParallelLibrary::IsInWorkerKernel()
+{
+	return GIsInWorkerKernel;
+}
+
+bool UJesterParallelLibrary::CanRunOnWorkers(const UObject* Object, FName FunctionName)
+{
+	if (!GAllowScriptWorkers || Object == nullptr)
+	{
+		return false;
+	}
+
+	const UFunction* Function = Object->FindFunction(FunctionName);
+	if (Function == nullptr)
+	{
+		return false;
+	}
+
+#if WITH_METADATA
+	static const FName ThreadSafeMetaData(TEXT("BlueprintThreadSafe"));
+	if (!Function->HasMetaData(ThreadSafeMetaData))
+	{
+		UE_LOG(LogJesterToolbox, Error, TEXT("%s::%s isn't marked BlueprintThreadSafe, running it on the game thread"),
+			*Object->GetClass()->GetName(), *FunctionName.ToString());
+		return false;
+	}
+#endif
+	return true;
+}
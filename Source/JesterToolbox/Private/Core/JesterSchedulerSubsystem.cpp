@@ -0,0 +1,192 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/JesterSchedulerSubsystem.h"
+
+#include "Engine/World.h"
+#include "JesterToolbox.h"
+#include "JesterToolboxStats.h"
+#include "JesterToolboxTrace.h"
+
+TRACE_DECLARE_INT_COUNTER(JesterPendingScheduledWork, TEXT("JesterToolbox/PendingScheduledWork"));
+
+namespace
+{
+	constexpr double DefaultLaneBudgetsMs[] = { 2.0, 1.0, 0.5 };
+}
+
+void UJesterSchedulerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	for (int32 i = 0; i < UE_ARRAY_COUNT(Lanes); ++i)
+	{
+		Lanes[i].BudgetSeconds = DefaultLaneBudgetsMs[i] / 1000.0;
+	}
+}
+
+FJesterWorkHandle UJesterSchedulerSubsystem::Schedule(TFunction<void()>&& Work, EJesterWorkPriority Priority, float DeadlineSeconds)
+{
+	check(Priority < EJesterWorkPriority::MAX);
+
+	FWorkItem Item;
+	Item.Work = MoveTemp(Work);
+	Item.Deadline = DeadlineSeconds >= 0.0f ? GetWorld()->GetTimeSeconds() + DeadlineSeconds : MAX_dbl;
+	Item.ScheduledFrame = GFrameCounter;
+	Item.Id = NextId++;
+	if (NextId <= 0)
+	{
+		NextId = 1;
+	}
+
+	FJesterWorkHandle Handle;
+	Handle.Id = Item.Id;
+	Lanes[static_cast<int32>(Priority)].Items.HeapPush(MoveTemp(Item), FWorkItemOrder());
+	UpdatePendingStat();
+	return Handle;
+}
+
+FJesterWorkHandle UJesterSchedulerSubsystem::ScheduleDelegate(FJesterDeferredWork Work, EJesterWorkPriority Priority, float DeadlineSeconds)
+{
+	return Schedule([Work]()
+	{
+		Work.ExecuteIfBound();
+	}, Priority, DeadlineSeconds);
+}
+
+bool UJesterSchedulerSubsystem::Cancel(FJesterWorkHandle Handle)
+{
+	if (!Handle.IsValid())
+	{
+		return false;
+	}
+
+	for (FLane& Lane : Lanes)
+	{
+		const int32 Index = Lane.Items.IndexOfByPredicate([&Handle](const FWorkItem& Item) { return Item.Id == Handle.Id; });
+		if (Index != INDEX_NONE)
+		{
+			Lane.Items.HeapRemoveAt(Index, FWorkItemOrder());
+			UpdatePendingStat();
+			return true;
+		}
+	}
+	return false;
+}
+
+void UJesterSchedulerSubsystem::SetLaneBudget(EJesterWorkPriority Priority, float BudgetMs)
+{
+	check(Priority < EJesterWorkPriority::MAX);
+	Lanes[static_cast<int32>(Priority)].BudgetSeconds = FMath::Max(BudgetMs, 0.0f) / 1000.0;
+}
+
+float UJesterSchedulerSubsystem::GetLaneBudget(EJesterWorkPriority Priority) const
+{
+	check(Priority < EJesterWorkPriority::MAX);
+	return Lanes[static_cast<int32>(Priority)].BudgetSeconds * 1000.0;
+}
+
+int32 UJesterSchedulerSubsystem::GetNumPendingWork() const
+{
+	int32 NumPendingWork = 0;
+	for (const FLane& Lane : Lanes)
+	{
+		NumPendingWork += Lane.Items.Num();
+	}
+	return NumPendingWork;
+}
+
+void UJesterSchedulerSubsystem::Tick(float DeltaTime)
+{
+	JESTER_TRACE_SCOPE("Jester::Scheduler::Tick");
+	if (GetNumPendingWork() == 0)
+	{
+		return;
+	}
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	for (int32 i = 0; i < UE_ARRAY_COUNT(Lanes); ++i)
+	{
+		FLane& Lane = Lanes[i];
+		if (Lane.Items.Num() == 0)
+		{
+			continue;
+		}
+
+		const double SpentSeconds = RunLane(Lane, Now, GFrameCounter);
+		if (SpentSeconds > Lane.BudgetSeconds)
+		{
+			JESTER_STAT_INC(SchedulerBudgetOverruns);
+			UE_LOG(LogJesterToolbox, Verbose, TEXT("Scheduler lane %s went over budget: %.3f ms for %.3f ms"),
+				*UEnum::GetValueAsString(static_cast<EJesterWorkPriority>(i)), SpentSeconds * 1000.0, Lane.BudgetSeconds * 1000.0);
+		}
+	}
+	UpdatePendingStat();
+}
+
+TStatId UJesterSchedulerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UJesterSchedulerSubsystem, STATGROUP_JesterToolbox);
+}
+
+void UJesterSchedulerSubsystem::Deinitialize()
+{
+	for (FLane& Lane : Lanes)
+	{
+		Lane.Items.Empty();
+	}
+	UpdatePendingStat();
+	Super::Deinitialize();
+}
+
+bool UJesterSchedulerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+double UJesterSchedulerSubsystem::RunLane(FLane& Lane, double Now, uint64 Frame)
+{
+	const double StartSeconds = FPlatformTime::Seconds();
+
+	// Overdue and starving work first, whatever the budget
+	TArray<FWorkItem> UrgentItems;
+	for (int32 i = Lane.Items.Num() - 1; i >= 0; --i)
+	{
+		const FWorkItem& Item = Lane.Items[i];
+		if (Item.Deadline <= Now || (MaxWaitFrames >= 0 && Frame - Item.ScheduledFrame >= static_cast<uint64>(MaxWaitFrames)))
+		{
+			UrgentItems.Add(MoveTemp(Lane.Items[i]));
+			Lane.Items.RemoveAtSwap(i, 1, false);
+		}
+	}
+	if (UrgentItems.Num() > 0)
+	{
+		Lane.Items.Heapify(FWorkItemOrder());
+		UrgentItems.Sort(FWorkItemOrder());
+		for (FWorkItem& Item : UrgentItems)
+		{
+			RunItem(Item);
+		}
+	}
+
+	// Then the queue, as long as there's budget left. An item that starts within budget always finishes
+	while (Lane.Items.Num() > 0 && FPlatformTime::Seconds() - StartSeconds < Lane.BudgetSeconds)
+	{
+		FWorkItem Item;
+		Lane.Items.HeapPop(Item, FWorkItemOrder(), false);
+		RunItem(Item);
+	}
+
+	return FPlatformTime::Seconds() - StartSeconds;
+}
+
+void UJesterSchedulerSubsystem::RunItem(FWorkItem& Item)
+{
+	JESTER_STAT_INC(ScheduledWorkRun);
+	Item.Work();
+}
+
+void UJesterSchedulerSubsystem::UpdatePendingStat()
+{
+	const int32 NumPendingWork = GetNumPendingWork();
+	JESTER_TRACE_COUNTER_SET(JesterPendingScheduledWork, NumPendingWork);
+	JESTER_STAT_SET(PendingScheduledWork, NumPendingWork);
+}
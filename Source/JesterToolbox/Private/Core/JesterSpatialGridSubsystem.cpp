@@ -0,0 +1,331 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/JesterSpatialGridSubsystem.h"
+
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "JesterToolbox.h"
+#include "JesterToolboxStats.h"
+#include "JesterToolboxTrace.h"
+
+TRACE_DECLARE_INT_COUNTER(JesterSpatialGridActors, TEXT("JesterToolbox/SpatialGridActors"));
+
+template<typename TVisitor>
+void UJesterSpatialGridSubsystem::ForEachInRadius(const FVector& Center, float Radius, const UClass* ActorClass, TVisitor Visitor) const
+{
+	const double RadiusSquared = FMath::Square(static_cast<double>(Radius));
+	auto VisitCell = [&](const TArray<int32>& Cell)
+	{
+		for (const int32 EntryIndex : Cell)
+		{
+			const FEntry& Entry = Entries[EntryIndex];
+			const double DistanceSquared = FVector::DistSquared(Entry.Location, Center);
+			if (DistanceSquared > RadiusSquared)
+			{
+				continue;
+			}
+
+			// Gone since the last refresh
+			AActor* Actor = Entry.Actor.Get();
+			if (Actor != nullptr && (!ActorClass || Actor->IsA(ActorClass)))
+			{
+				Visitor(Actor, DistanceSquared);
+			}
+		}
+	};
+
+	const FIntVector Min = GetCell(Center - FVector(Radius));
+	const FIntVector Max = GetCell(Center + FVector(Radius));
+	const int64 NumCellsInBounds = static_cast<int64>(Max.X - Min.X + 1) * (Max.Y - Min.Y + 1) * (Max.Z - Min.Z + 1);
+
+	// A radius much larger than the cells covers mostly empty ones, walking the occupied cells is cheaper then
+	if (NumCellsInBounds > Cells.Num())
+	{
+		for (const TPair<FIntVector, TArray<int32>>& Pair : Cells)
+		{
+			const FIntVector& Cell = Pair.Key;
+			if (Cell.X >= Min.X && Cell.X <= Max.X && Cell.Y >= Min.Y && Cell.Y <= Max.Y && Cell.Z >= Min.Z && Cell.Z <= Max.Z)
+			{
+				VisitCell(Pair.Value);
+			}
+		}
+		return;
+	}
+
+	for (int32 X = Min.X; X <= Max.X; ++X)
+	{
+		for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+		{
+			for (int32 Z = Min.Z; Z <= Max.Z; ++Z)
+			{
+				if (const TArray<int32>* Cell = Cells.Find(FIntVector(X, Y, Z)))
+				{
+					VisitCell(*Cell);
+				}
+			}
+		}
+	}
+}
+
+void UJesterSpatialGridSubsystem::Register(AActor* Actor)
+{
+	if (!IsValid(Actor))
+	{
+		UE_LOG(LogJesterToolbox, Warning, TEXT("Tried to register an invalid actor in the spatial grid"));
+		return;
+	}
+
+	if (ActorToEntry.Contains(Actor))
+	{
+		return;
+	}
+
+	const int32 EntryIndex = Entries.AddDefaulted();
+	FEntry& Entry = Entries[EntryIndex];
+	Entry.Actor = Actor;
+	Entry.Key = Actor;
+	Entry.Location = Actor->GetActorLocation();
+	Entry.Cell = GetCell(Entry.Location);
+	ActorToEntry.Add(Actor, EntryIndex);
+	AddToCell(EntryIndex);
+
+	Actor->OnDestroyed.AddUniqueDynamic(this, &UJesterSpatialGridSubsystem::HandleActorDestroyed);
+	Actor->OnEndPlay.AddUniqueDynamic(this, &UJesterSpatialGridSubsystem::HandleActorEndPlay);
+	JESTER_TRACE_COUNTER_SET(JesterSpatialGridActors, Entries.Num());
+}
+
+void UJesterSpatialGridSubsystem::Unregister(AActor* Actor)
+{
+	if (const int32* EntryIndex = ActorToEntry.Find(Actor))
+	{
+		RemoveEntry(*EntryIndex);
+	}
+}
+
+void UJesterSpatialGridSubsystem::RemoveEntry(int32 EntryIndex)
+{
+	FEntry& Entry = Entries[EntryIndex];
+	if (AActor* Actor = Entry.Actor.Get())
+	{
+		Actor->OnDestroyed.RemoveDynamic(this, &UJesterSpatialGridSubsystem::HandleActorDestroyed);
+		Actor->OnEndPlay.RemoveDynamic(this, &UJesterSpatialGridSubsystem::HandleActorEndPlay);
+	}
+	ActorToEntry.Remove(Entry.Key);
+
+	RemoveFromCell(EntryIndex);
+
+	// Swap the last entry into the hole and point its cell and map slot at the new index
+	const int32 LastIndex = Entries.Num() - 1;
+	if (EntryIndex != LastIndex)
+	{
+		Entries[EntryIndex] = Entries[LastIndex];
+		const FEntry& Moved = Entries[EntryIndex];
+		Cells.FindChecked(Moved.Cell)[Moved.IndexInCell] = EntryIndex;
+		ActorToEntry.FindChecked(Moved.Key) = EntryIndex;
+	}
+	Entries.RemoveAt(LastIndex, 1, false);
+	JESTER_TRACE_COUNTER_SET(JesterSpatialGridActors, Entries.Num());
+}
+
+void UJesterSpatialGridSubsystem::UpdateLocation(AActor* Actor)
+{
+	if (const int32* EntryIndex = ActorToEntry.Find(Actor))
+	{
+		SetLocation(*EntryIndex, Actor->GetActorLocation());
+	}
+}
+
+void UJesterSpatialGridSubsystem::UpdateAllLocations()
+{
+	JESTER_TRACE_SCOPE("Jester::SpatialGrid::UpdateAllLocations");
+	// Backwards, removing an entry moves the last one into its slot
+	for (int32 i = Entries.Num() - 1; i >= 0; --i)
+	{
+		if (const AActor* Actor = Entries[i].Actor.Get())
+		{
+			SetLocation(i, Actor->GetActorLocation());
+		}
+		else
+		{
+			RemoveEntry(i);
+		}
+	}
+}
+
+void UJesterSpatialGridSubsystem::QueryRadius(FVector Center, float Radius, TArray<AActor*>& OutActors, TSubclassOf<AActor> ActorClass) const
+{
+	JESTER_TRACE_SCOPE("Jester::SpatialGrid::QueryRadius");
+	OutActors.Reset();
+	ForEachInRadius(Center, Radius, ActorClass.Get(), [&OutActors](AActor* Actor, double)
+	{
+		OutActors.Add(Actor);
+	});
+}
+
+void UJesterSpatialGridSubsystem::QueryNearest(FVector Center, int32 Count, float MaxRadius, TArray<AActor*>& OutActors, TSubclassOf<AActor> ActorClass) const
+{
+	JESTER_TRACE_SCOPE("Jester::SpatialGrid::QueryNearest");
+	OutActors.Reset();
+	if (Count <= 0 || MaxRadius <= 0.0f || Entries.Num() == 0)
+	{
+		return;
+	}
+
+	struct FCandidate
+	{
+		double DistanceSquared;
+		AActor* Actor;
+	};
+	TArray<FCandidate, TInlineAllocator<32>> Candidates;
+
+	// Grow the search radius a cell at a time until it holds enough actors, anything outside of it is further away
+	// than everything inside so the nearest Count are found without visiting the whole radius
+	float SearchRadius = FMath::Min(CellSize, MaxRadius);
+	while (true)
+	{
+		Candidates.Reset();
+		ForEachInRadius(Center, SearchRadius, ActorClass.Get(), [&Candidates](AActor* Actor, double DistanceSquared)
+		{
+			Candidates.Add({ DistanceSquared, Actor });
+		});
+
+		if (Candidates.Num() >= Count || SearchRadius >= MaxRadius || Candidates.Num() == Entries.Num())
+		{
+			break;
+		}
+		SearchRadius = FMath::Min(SearchRadius * 2.0f, MaxRadius);
+	}
+
+	Candidates.Sort([](const FCandidate& A, const FCandidate& B) { return A.DistanceSquared < B.DistanceSquared; });
+	const int32 NumResults = FMath::Min(Count, Candidates.Num());
+	OutActors.Reserve(NumResults);
+	for (int32 i = 0; i < NumResults; ++i)
+	{
+		OutActors.Add(Candidates[i].Actor);
+	}
+}
+
+void UJesterSpatialGridSubsystem::QueryRadiusBatch(const TArray<FVector>& Centers, float Radius, TArray<FJesterSpatialQueryResult>& OutResults, TSubclassOf<AActor> ActorClass) const
+{
+	JESTER_TRACE_SCOPE("Jester::SpatialGrid::QueryRadiusBatch");
+	OutResults.SetNum(Centers.Num());
+
+	// Queries only read the grid, so they can run side by side
+	const UClass* Class = ActorClass.Get();
+	ParallelFor(Centers.Num(), [this, &Centers, &OutResults, Radius, Class](int32 i)
+	{
+		TArray<AActor*>& Actors = OutResults[i].Actors;
+		Actors.Reset();
+		ForEachInRadius(Centers[i], Radius, Class, [&Actors](AActor* Actor, double)
+		{
+			Actors.Add(Actor);
+		});
+	});
+}
+
+void UJesterSpatialGridSubsystem::SetCellSize(float InCellSize)
+{
+	if (!ensureMsgf(InCellSize > 0.0f, TEXT("Spatial grid cell size must be positive, got %f"), InCellSize))
+	{
+		return;
+	}
+
+	CellSize = InCellSize;
+	Cells.Reset();
+	for (int32 i = 0; i < Entries.Num(); ++i)
+	{
+		Entries[i].Cell = GetCell(Entries[i].Location);
+		AddToCell(i);
+	}
+}
+
+void UJesterSpatialGridSubsystem::Tick(float DeltaTime)
+{
+	if (bUpdateLocationsEveryFrame)
+	{
+		UpdateAllLocations();
+	}
+}
+
+TStatId UJesterSpatialGridSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UJesterSpatialGridSubsystem, STATGROUP_JesterToolbox);
+}
+
+void UJesterSpatialGridSubsystem::Deinitialize()
+{
+	for (const FEntry& Entry : Entries)
+	{
+		if (AActor* Actor = Entry.Actor.Get())
+		{
+			Actor->OnDestroyed.RemoveDynamic(this, &UJesterSpatialGridSubsystem::HandleActorDestroyed);
+			Actor->OnEndPlay.RemoveDynamic(this, &UJesterSpatialGridSubsystem::HandleActorEndPlay);
+		}
+	}
+	Entries.Empty();
+	ActorToEntry.Empty();
+	Cells.Empty();
+	JESTER_TRACE_COUNTER_SET(JesterSpatialGridActors, 0);
+	Super::Deinitialize();
+}
+
+bool UJesterSpatialGridSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UJesterSpatialGridSubsystem::HandleActorDestroyed(AActor* Actor)
+{
+	Unregister(Actor);
+}
+
+void UJesterSpatialGridSubsystem::HandleActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+	Unregister(Actor);
+}
+
+FIntVector UJesterSpatialGridSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntVector(
+		FMath::FloorToInt(Location.X / CellSize),
+		FMath::FloorToInt(Location.Y / CellSize),
+		FMath::FloorToInt(Location.Z / CellSize));
+}
+
+void UJesterSpatialGridSubsystem::AddToCell(int32 EntryIndex)
+{
+	FEntry& Entry = Entries[EntryIndex];
+	TArray<int32>& Cell = Cells.FindOrAdd(Entry.Cell);
+	Entry.IndexInCell = Cell.Add(EntryIndex);
+}
+
+void UJesterSpatialGridSubsystem::RemoveFromCell(int32 EntryIndex)
+{
+	const FEntry& Entry = Entries[EntryIndex];
+	TArray<int32>& Cell = Cells.FindChecked(Entry.Cell);
+	Cell.RemoveAtSwap(Entry.IndexInCell, 1, false);
+	if (Entry.IndexInCell < Cell.Num())
+	{
+		Entries[Cell[Entry.IndexInCell]].IndexInCell = Entry.IndexInCell;
+	}
+	if (Cell.Num() == 0)
+	{
+		Cells.Remove(Entry.Cell);
+	}
+}
+
+void UJesterSpatialGridSubsystem::SetLocation(int32 EntryIndex, const FVector& Location)
+{
+	FEntry& Entry = Entries[EntryIndex];
+	Entry.Location = Location;
+
+	// Most actors stay in their cell from one frame to the next
+	const FIntVector NewCell = GetCell(Location);
+	if (NewCell != Entry.Cell)
+	{
+		RemoveFromCell(EntryIndex);
+		Entry.Cell = NewCell;
+		AddToCell(EntryIndex);
+	}
+}
@@ -0,0 +1,307 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/JesterSpawnTemplateSubsystem.h"
+
+#include "Components/ActorComponent.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "JesterToolbox.h"
+#include "JesterToolboxStats.h"
+#include "JesterToolboxTrace.h"
+
+namespace
+{
+	bool GValidateTemplates = false;
+	FAutoConsoleVariableRef CVarValidateTemplates(
+		TEXT("Jester.Spawn.ValidateTemplates"),
+		GValidateTemplates,
+		TEXT("When true, the first template spawn of each class is compared against a normally spawned actor"));
+
+	// References to the actor or its components point at each actor's own objects, those are compared by name
+	bool IsInActor(const UObject* Object, const AActor* Actor)
+	{
+		return Object != nullptr && (Object == Actor || Object->IsIn(Actor));
+	}
+
+	int32 DiffObjects(const UObject* Expected, const AActor* ExpectedActor, const UObject* Actual, const AActor* ActualActor)
+	{
+		int32 NumDifferences = 0;
+		for (TFieldIterator<FProperty> It(Expected->GetClass()); It; ++It)
+		{
+			const FProperty* Property = *It;
+			if (Property->HasAnyPropertyFlags(CPF_Transient | CPF_DuplicateTransient | CPF_NonPIEDuplicateTransient))
+			{
+				continue;
+			}
+
+			for (int32 i = 0; i < Property->ArrayDim; ++i)
+			{
+				const void* ExpectedValue = Property->ContainerPtrToValuePtr<void>(Expected, i);
+				const void* ActualValue = Property->ContainerPtrToValuePtr<void>(Actual, i);
+				if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+				{
+					const UObject* ExpectedObject = ObjectProperty->GetObjectPropertyValue(ExpectedValue);
+					const UObject* ActualObject = ObjectProperty->GetObjectPropertyValue(ActualValue);
+					if (IsInActor(ExpectedObject, ExpectedActor) && IsInActor(ActualObject, ActualActor))
+					{
+						if (ExpectedObject->GetFName() != ActualObject->GetFName())
+						{
+							UE_LOG(LogJesterToolbox, Warning, TEXT("%s.%s: spawned points at %s, clone points at %s"),
+								*Expected->GetName(), *Property->GetName(), *ExpectedObject->GetName(), *ActualObject->GetName());
+							++NumDifferences;
+						}
+						continue;
+					}
+				}
+
+				if (!Property->Identical(ExpectedValue, ActualValue, PPF_None))
+				{
+					FString ExpectedText;
+					FString ActualText;
+					Property->ExportTextItem_Direct(ExpectedText, ExpectedValue, nullptr, nullptr, PPF_None);
+					Property->ExportTextItem_Direct(ActualText, ActualValue, nullptr, nullptr, PPF_None);
+					UE_LOG(LogJesterToolbox, Warning, TEXT("%s.%s: spawned %s, clone %s"),
+						*Expected->GetName(), *Property->GetName(), *ExpectedText, *ActualText);
+					++NumDifferences;
+				}
+			}
+		}
+		return NumDifferences;
+	}
+
+	int32 DiffActors(const AActor* Expected, const AActor* Actual)
+	{
+		int32 NumDifferences = DiffObjects(Expected, Expected, Actual, Actual);
+
+		TInlineComponentArray<UActorComponent*> ExpectedComponents(Expected);
+		TInlineComponentArray<UActorComponent*> ActualComponents(Actual);
+		for (const UActorComponent* ExpectedComponent : ExpectedComponents)
+		{
+			UActorComponent* const* ActualComponent = ActualComponents.FindByPredicate([ExpectedComponent](const UActorComponent* Component)
+			{
+				return Component->GetFName() == ExpectedComponent->GetFName();
+			});
+			if (ActualComponent == nullptr)
+			{
+				UE_LOG(LogJesterToolbox, Warning, TEXT("%s is missing from the clone"), *ExpectedComponent->GetName());
+				++NumDifferences;
+				continue;
+			}
+			NumDifferences += DiffObjects(ExpectedComponent, Expected, *ActualComponent, Actual);
+		}
+
+		if (ActualComponents.Num() > ExpectedComponents.Num())
+		{
+			UE_LOG(LogJesterToolbox, Warning, TEXT("Clone has %d components, the spawned actor %d"), ActualComponents.Num(), ExpectedComponents.Num());
+			++NumDifferences;
+		}
+		return NumDifferences;
+	}
+
+	// Clones have to come out registered like a spawned actor, the archetype must never be
+	int32 DiffRegistration(const AActor* Archetype, const AActor* Expected, const AActor* Actual)
+	{
+		int32 NumDifferences = 0;
+		TInlineComponentArray<UActorComponent*> ArchetypeComponents(Archetype);
+		for (const UActorComponent* Component : ArchetypeComponents)
+		{
+			if (Component->IsRegistered())
+			{
+				UE_LOG(LogJesterToolbox, Warning, TEXT("%s is registered on the template"), *Component->GetName());
+				++NumDifferences;
+			}
+		}
+
+		TInlineComponentArray<UActorComponent*> ExpectedComponents(Expected);
+		TInlineComponentArray<UActorComponent*> ActualComponents(Actual);
+		for (const UActorComponent* ActualComponent : ActualComponents)
+		{
+			UActorComponent* const* ExpectedComponent = ExpectedComponents.FindByPredicate([ActualComponent](const UActorComponent* Component)
+			{
+				return Component->GetFName() == ActualComponent->GetFName();
+			});
+			if (ExpectedComponent != nullptr && (*ExpectedComponent)->IsRegistered() != ActualComponent->IsRegistered())
+			{
+				UE_LOG(LogJesterToolbox, Warning, TEXT("%s: spawned is %s, clone is %s"), *ActualComponent->GetName(),
+					(*ExpectedComponent)->IsRegistered() ? TEXT("registered") : TEXT("unregistered"),
+					ActualComponent->IsRegistered() ? TEXT("registered") : TEXT("unregistered"));
+				++NumDifferences;
+			}
+		}
+		return NumDifferences;
+	}
+}
+
+AActor* UJesterSpawnTemplateSubsystem::SpawnFromTemplate(TSubclassOf<AActor> ActorClass, const FTransform& Transform, ULevel* Level)
+{
+	JESTER_TRACE_SCOPE("Jester::SpawnFromTemplate");
+	JESTER_SCOPE_CYCLE_COUNTER(Spawn);
+	JESTER_STAT_INC(SpawnCalls);
+	if (ActorClass == nullptr)
+	{
+		UE_LOG(LogJesterToolbox, Error, TEXT("SpawnFromTemplate called without a class"));
+		return nullptr;
+	}
+
+	if (GValidateTemplates && !ValidatedClasses.Contains(ActorClass))
+	{
+		ValidateTemplateClone(ActorClass);
+	}
+
+	const FJesterSpawnArchetype* Archetype = GetOrCreateArchetype(ActorClass);
+	if (Archetype == nullptr)
+	{
+		return nullptr;
+	}
+	AActor* Clone = CloneArchetype(*Archetype, Transform, Level != nullptr ? Level : GetWorld()->PersistentLevel.Get());
+	OnTemplateActorSpawned.Broadcast(Clone);
+	return Clone;
+}
+
+void UJesterSpawnTemplateSubsystem::PrewarmTemplate(TSubclassOf<AActor> ActorClass)
+{
+	if (ActorClass != nullptr)
+	{
+		GetOrCreateArchetype(ActorClass);
+	}
+}
+
+void UJesterSpawnTemplateSubsystem::ResetTemplate(TSubclassOf<AActor> ActorClass)
+{
+	FJesterSpawnArchetype Archetype;
+	if (Archetypes.RemoveAndCopyValue(ActorClass, Archetype) && Archetype.Actor != nullptr)
+	{
+		Archetype.Actor->MarkAsGarbage();
+	}
+}
+
+int32 UJesterSpawnTemplateSubsystem::ValidateTemplateClone(TSubclassOf<AActor> ActorClass)
+{
+	JESTER_TRACE_SCOPE("Jester::ValidateTemplateClone");
+	if (ActorClass == nullptr)
+	{
+		return 0;
+	}
+	ValidatedClasses.Add(ActorClass);
+
+	// A copy, the spawned actor's BeginPlay can build other archetypes and move the map
+	const FJesterSpawnArchetype* FoundArchetype = GetOrCreateArchetype(ActorClass);
+	if (FoundArchetype == nullptr)
+	{
+		return 0;
+	}
+	const FJesterSpawnArchetype Archetype = *FoundArchetype;
+
+	// Both at the archetype's transform, so construction scripts that read the location can't make a false difference
+	UWorld* World = GetWorld();
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	AActor* Spawned = World->SpawnActor(ActorClass, &FTransform::Identity, Params);
+	AActor* Cloned = CloneArchetype(Archetype, FTransform::Identity, World->PersistentLevel);
+	if (Spawned == nullptr || Cloned == nullptr)
+	{
+		UE_LOG(LogJesterToolbox, Error, TEXT("Could not spawn %s to validate its template"), *ActorClass->GetName());
+		return 0;
+	}
+
+	const int32 NumDifferences = DiffActors(Spawned, Cloned) + DiffRegistration(Archetype.Actor, Spawned, Cloned);
+	if (NumDifferences > 0)
+	{
+		UE_LOG(LogJesterToolbox, Warning, TEXT("%s: %d differences between a spawned actor and a template clone, don't spawn it from a template"),
+			*ActorClass->GetName(), NumDifferences);
+	}
+	else
+	{
+		UE_LOG(LogJesterToolbox, Display, TEXT("%s: template clone matches a spawned actor"), *ActorClass->GetName());
+	}
+
+	Spawned->Destroy();
+	Cloned->Destroy();
+	return NumDifferences;
+}
+
+void UJesterSpawnTemplateSubsystem::Deinitialize()
+{
+	for (const TPair<UClass*, FJesterSpawnArchetype>& Pair : Archetypes)
+	{
+		if (Pair.Value.Actor != nullptr)
+		{
+			Pair.Value.Actor->MarkAsGarbage();
+		}
+	}
+	Archetypes.Empty();
+	ValidatedClasses.Empty();
+	Super::Deinitialize();
+}
+
+bool UJesterSpawnTemplateSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+const FJesterSpawnArchetype* UJesterSpawnTemplateSubsystem::GetOrCreateArchetype(UClass* ActorClass)
+{
+	if (const FJesterSpawnArchetype* Archetype = Archetypes.Find(ActorClass))
+	{
+		return Archetype;
+	}
+
+	JESTER_TRACE_SCOPE("Jester::CreateSpawnArchetype");
+	UWorld* World = GetWorld();
+	FActorSpawnParameters Params;
+	Params.Name = MakeUniqueObjectName(World->PersistentLevel, ActorClass, *FString::Printf(TEXT("JesterTemplate_%s"), *ActorClass->GetName()));
+	Params.bDeferConstruction = true;
+	Params.ObjectFlags |= RF_Transient;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	AActor* Archetype = World->SpawnActor(ActorClass, &FTransform::Identity, Params);
+	if (Archetype == nullptr)
+	{
+		UE_LOG(LogJesterToolbox, Error, TEXT("Could not spawn the template of %s"), *ActorClass->GetName());
+		return nullptr;
+	}
+
+	// Runs the construction scripts, the archetype never begins play
+	Archetype->ExecuteConstruction(FTransform::Identity, nullptr, nullptr, true);
+
+	// Spawning and construction registered the components, without this the archetype would render and collide at
+	// the origin for the whole session. Hidden and without collision as well, in case anything registers them again
+	FJesterSpawnArchetype& Entry = Archetypes.Add(ActorClass);
+	Entry.Actor = Archetype;
+	Entry.bHidden = Archetype->IsHidden();
+	Entry.bEnableCollision = Archetype->GetActorEnableCollision();
+	Archetype->UnregisterAllComponents();
+	Archetype->SetActorHiddenInGame(true);
+	Archetype->SetActorEnableCollision(false);
+
+	// Out of the level's actor list, so actor iterators and the net driver never see it
+	World->RemoveActor(Archetype, false);
+	World->RemoveNetworkActor(Archetype);
+	return &Entry;
+}
+
+AActor* UJesterSpawnTemplateSubsystem::CloneArchetype(const FJesterSpawnArchetype& Archetype, const FTransform& Transform, ULevel* Level)
+{
+	JESTER_TRACE_SCOPE("Jester::CloneArchetype");
+	UWorld* World = GetWorld();
+
+	// Duplicating brings the construction script components along with their state
+	AActor* Clone = DuplicateObject<AActor>(Archetype.Actor, Level);
+	Level->Actors.Add(Clone);
+	World->AddNetworkActor(Clone);
+	Clone->SetActorTransform(Transform);
+	Clone->SetActorHiddenInGame(Archetype.bHidden);
+	Clone->SetActorEnableCollision(Archetype.bEnableCollision);
+
+	// Same steps as ULevel::RouteActorInitialize for the actors loaded with a level, which don't run construction either
+	Clone->RegisterAllComponents();
+	Clone->PreInitializeComponents();
+	Clone->InitializeComponents();
+	Clone->PostInitializeComponents();
+	if (World->HasBegunPlay())
+	{
+		Clone->DispatchBeginPlay();
+	}
+	return Clone;
+}
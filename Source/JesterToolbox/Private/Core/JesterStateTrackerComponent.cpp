@@ -0,0 +1,199 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/JesterStateTrackerComponent.h"
+
+#include "Engine/NetSerialization.h"
+#include "JesterToolbox.h"
+#include "Net/UnrealNetwork.h"
+
+namespace
+{
+	// Bits a connection last received, the base the next delta is computed from
+	class FJesterStateBitsetDeltaState : public INetDeltaBaseState
+	{
+	public:
+		virtual bool IsStateEqual(INetDeltaBaseState* OtherState) override
+		{
+			return Words == static_cast<FJesterStateBitsetDeltaState*>(OtherState)->Words;
+		}
+
+		TArray<uint32> Words;
+	};
+}
+
+void FJesterStateBitset::Set(int32 Index, bool bValue)
+{
+	check(Index >= 0 && Index < MaxStates);
+	const int32 WordIndex = Index / 32;
+	if (bValue)
+	{
+		if (WordIndex >= Words.Num())
+		{
+			Words.SetNumZeroed(WordIndex + 1);
+		}
+		Words[WordIndex] |= 1u << (Index % 32);
+	}
+	else if (Words.IsValidIndex(WordIndex))
+	{
+		Words[WordIndex] &= ~(1u << (Index % 32));
+	}
+}
+
+bool FJesterStateBitset::NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+{
+	if (DeltaParms.Writer != nullptr)
+	{
+		const FJesterStateBitsetDeltaState* OldState = static_cast<const FJesterStateBitsetDeltaState*>(DeltaParms.OldState);
+		const TArray<uint32> NoWords;
+		const TArray<uint32>& OldWords = OldState != nullptr ? OldState->Words : NoWords;
+
+		// Changed bits are sent with their value rather than toggled, so applying an update twice is harmless
+		TArray<uint32, TInlineAllocator<8>> ChangedBits;
+		for (int32 WordIndex = 0; WordIndex < FMath::Max(Words.Num(), OldWords.Num()); ++WordIndex)
+		{
+			const uint32 Word = Words.IsValidIndex(WordIndex) ? Words[WordIndex] : 0;
+			const uint32 OldWord = OldWords.IsValidIndex(WordIndex) ? OldWords[WordIndex] : 0;
+			for (uint32 Changed = Word ^ OldWord; Changed != 0; Changed &= Changed - 1)
+			{
+				ChangedBits.Add(WordIndex * 32 + FMath::CountTrailingZeros(Changed));
+			}
+		}
+
+		if (OldState != nullptr && ChangedBits.Num() == 0)
+		{
+			return false;
+		}
+
+		TSharedPtr<FJesterStateBitsetDeltaState> NewState = MakeShared<FJesterStateBitsetDeltaState>();
+		NewState->Words = Words;
+		*DeltaParms.NewState = NewState;
+
+		FBitWriter& Writer = *DeltaParms.Writer;
+		uint32 NumChanged = ChangedBits.Num();
+		Writer.SerializeIntPacked(NumChanged);
+		for (uint32 Bit : ChangedBits)
+		{
+			uint8 bValue = IsSet(Bit) ? 1 : 0;
+			Writer.SerializeIntPacked(Bit);
+			Writer.SerializeBits(&bValue, 1);
+		}
+		return true;
+	}
+
+	if (DeltaParms.Reader != nullptr)
+	{
+		FBitReader& Reader = *DeltaParms.Reader;
+		uint32 NumChanged = 0;
+		Reader.SerializeIntPacked(NumChanged);
+		if (NumChanged > MaxStates)
+		{
+			Reader.SetError();
+			return false;
+		}
+
+		for (uint32 i = 0; i < NumChanged && !Reader.IsError(); ++i)
+		{
+			uint32 Bit = 0;
+			uint8 bValue = 0;
+			Reader.SerializeIntPacked(Bit);
+			Reader.SerializeBits(&bValue, 1);
+			if (Bit >= MaxStates)
+			{
+				Reader.SetError();
+				return false;
+			}
+			Set(Bit, bValue != 0);
+		}
+		return !Reader.IsError();
+	}
+
+	return true;
+}
+
+UJesterStateTrackerComponent::UJesterStateTrackerComponent()
+{
+	SetIsReplicatedByDefault(true);
+}
+
+void UJesterStateTrackerComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+	DOREPLIFETIME(UJesterStateTrackerComponent, ReplicatedStates);
+}
+
+void UJesterStateTrackerComponent::InitializeStateIndex(const TArray<FGameplayTag>& States)
+{
+	checkf(States.Num() <= FJesterStateBitset::MaxStates, TEXT("%s has %d states, at most %d can replicate"),
+		*GetPathName(), States.Num(), FJesterStateBitset::MaxStates);
+
+	StateIndex = States;
+	StateIndex.Sort([](const FGameplayTag& A, const FGameplayTag& B) { return A.GetTagName().LexicalLess(B.GetTagName()); });
+	StateToBit.Reset();
+	for (int32 Bit = 0; Bit < StateIndex.Num(); ++Bit)
+	{
+		StateToBit.Add(StateIndex[Bit], Bit);
+	}
+	bStateIndexInitialized = true;
+
+	// Updates that came before the index was known
+	OnRep_ReplicatedStates();
+}
+
+void UJesterStateTrackerComponent::SetStateReplicated(FGameplayTag StateTag, bool bActive)
+{
+	EnsureStateIndex();
+	const int32* Bit = StateToBit.Find(StateTag);
+	if (Bit == nullptr)
+	{
+		UE_LOG(LogJesterToolbox, Error, TEXT("State %s isn't in the state index of %s"), *StateTag.ToString(), *GetPathName());
+		return;
+	}
+
+	if (GetOwnerRole() == ROLE_Authority)
+	{
+		ReplicatedStates.Set(*Bit, bActive);
+	}
+	AppliedStates.Set(*Bit, bActive);
+}
+
+TArray<FGameplayTag> UJesterStateTrackerComponent::GetTrackedStates_Implementation() const
+{
+	return {};
+}
+
+void UJesterStateTrackerComponent::OnReplicatedStateChanged_Implementation(FGameplayTag StateTag, bool bAdded)
+{
+}
+
+void UJesterStateTrackerComponent::EnsureStateIndex()
+{
+	if (!bStateIndexInitialized)
+	{
+		InitializeStateIndex(GetTrackedStates());
+	}
+}
+
+void UJesterStateTrackerComponent::OnRep_ReplicatedStates()
+{
+	if (GetOwnerRole() == ROLE_Authority)
+	{
+		return;
+	}
+
+	// Replication can come before BeginPlay
+	if (!bStateIndexInitialized)
+	{
+		EnsureStateIndex();
+		return;
+	}
+
+	for (int32 Bit = 0; Bit < StateIndex.Num(); ++Bit)
+	{
+		const bool bActive = ReplicatedStates.IsSet(Bit);
+		if (bActive != AppliedStates.IsSet(Bit))
+		{
+			AppliedStates.Set(Bit, bActive);
+			OnReplicatedStateChanged(StateIndex[Bit], bActive);
+		}
+	}
+}
@@ -0,0 +1,22 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/JesterStatsLibrary.h"
+
+#include "JesterToolboxStats.h"
+
+void UJesterStatsLibrary::ModifyCapabilityCount(int Delta)
+{
+	INC_DWORD_STAT_BY(STAT_JesterCapabilities, Delta);
+	JesterStats::Add(JesterStats::ECounter::Capabilities, Delta);
+}
+
+void UJesterStatsLibrary::AddCapabilityUpdate(int ActiveCapabilities)
+{
+	JESTER_STAT_INC(CapabilityUpdates);
+	JESTER_STAT_ADD(ActiveCapabilities, ActiveCapabilities);
+}
+
+void UJesterStatsLibrary::AddAggregatorUpdate()
+{
+	JESTER_STAT_INC(AggregatorUpdates);
+}
@@ -2,9 +2,29 @@
 #include "Core/ManagerLocatorSubsystem.h"
 
 #include "JesterToolbox.h"
+#include "JesterToolboxMemory.h"
+#include "JesterToolboxStats.h"
+#include "JesterToolboxTrace.h"
+
+TRACE_DECLARE_INT_COUNTER(JesterRegisteredManagers, TEXT("JesterToolbox/RegisteredManagers"));
+TRACE_DECLARE_INT_COUNTER(JesterManagerLookups, TEXT("JesterToolbox/ManagerLookups"));
+
+namespace
+{
+	// Actor whose destruction unregisters a keyed manager: the manager itself or the owner of the component
+	AActor* GetKeyedManagerActor(UObject* Manager)
+	{
+		if (const UActorComponent* Component = Cast<UActorComponent>(Manager))
+		{
+			return Component->GetOwner();
+		}
+		return Cast<AActor>(Manager);
+	}
+}
 
 void UManagerLocatorSubsystem::RegisterActorManager(AActor* Manager)
 {
+	JESTER_LLM_SCOPE(Managers);
 #if !UE_BUILD_SHIPPING
 	// Check and assert if the Manager is already registered
 	for (AActor* ExistingManager : ActorManagers)
@@ -17,12 +37,17 @@ void UManagerLocatorSubsystem::RegisterActorManager(AActor* Manager)
 	}
 #endif
 	ActorManagers.Add(Manager);
-	Manager->OnDestroyed.RemoveAll(this);
-	Manager->OnDestroyed.AddDynamic(this, &UManagerLocatorSubsystem::UnregisterActorManager);
+	AddToInterfaceIndex(Manager);
+	AddToClassIndex(Manager);
+	JESTER_TRACE_COUNTER_SET(JesterRegisteredManagers, ActorManagers.Num() + ComponentManagers.Num());
+	// The actor can also be a keyed manager, only touch this binding
+	Manager->OnDestroyed.AddUniqueDynamic(this, &UManagerLocatorSubsystem::UnregisterActorManager);
+	OnManagerRegistered.Broadcast(Manager);
 }
 
 void UManagerLocatorSubsystem::RegisterComponentManager(UActorComponent* Manager)
 {
+	JESTER_LLM_SCOPE(Managers);
 #if !UE_BUILD_SHIPPING
 	// Check and assert if the Manager is already registered
 	for (UActorComponent* ExistingManager : ComponentManagers)
@@ -35,8 +60,11 @@ void UManagerLocatorSubsystem::RegisterComponentManager(UActorComponent* Manager
 	}
 #endif
 	ComponentManagers.Add(Manager);
-	Manager->GetOwner()->OnDestroyed.RemoveAll(this);
-	Manager->GetOwner()->OnDestroyed.AddDynamic(this, &UManagerLocatorSubsystem::HandleComponentManagerOwnerDestroyed);
+	AddToInterfaceIndex(Manager);
+	AddToClassIndex(Manager);
+	JESTER_TRACE_COUNTER_SET(JesterRegisteredManagers, ActorManagers.Num() + ComponentManagers.Num());
+	Manager->GetOwner()->OnDestroyed.AddUniqueDynamic(this, &UManagerLocatorSubsystem::HandleComponentManagerOwnerDestroyed);
+	OnManagerRegistered.Broadcast(Manager);
 }
 
 void UManagerLocatorSubsystem::UnregisterActorManager(AActor* Manager)
@@ -46,7 +74,12 @@ void UManagerLocatorSubsystem::UnregisterActorManager(AActor* Manager)
 		return;
 	}
 	
-	ActorManagers.Remove(Manager);
+	if (ActorManagers.Remove(Manager) > 0)
+	{
+		RemoveFromInterfaceIndex(Manager);
+		RemoveFromClassIndex(Manager);
+	}
+	JESTER_TRACE_COUNTER_SET(JesterRegisteredManagers, ActorManagers.Num() + ComponentManagers.Num());
 	// Unbind
 	Manager->OnDestroyed.RemoveDynamic(this, &UManagerLocatorSubsystem::UnregisterActorManager);
 }
@@ -58,12 +91,43 @@ void UManagerLocatorSubsystem::UnregisterComponentManager(UActorComponent* Manag
 		return;
 	}
 	
-	ComponentManagers.Remove(Manager);
-	// Unbind
-	Manager->GetOwner()->OnDestroyed.RemoveDynamic(this, &UManagerLocatorSubsystem::HandleComponentManagerOwnerDestroyed);
+	if (ComponentManagers.Remove(Manager) > 0)
+	{
+		RemoveFromInterfaceIndex(Manager);
+		RemoveFromClassIndex(Manager);
+	}
+	JESTER_TRACE_COUNTER_SET(JesterRegisteredManagers, ActorManagers.Num() + ComponentManagers.Num());
+
+	// Unbind once no other component manager of the owner is left
+	AActor* Owner = Manager->GetOwner();
+	const bool bOwnerHasManagers = ComponentManagers.ContainsByPredicate([Owner](const UActorComponent* Other) { return Other->GetOwner() == Owner; });
+	if (Owner != nullptr && !bOwnerHasManagers)
+	{
+		Owner->OnDestroyed.RemoveDynamic(this, &UManagerLocatorSubsystem::HandleComponentManagerOwnerDestroyed);
+	}
 }
 
 UObject* UManagerLocatorSubsystem::GetManager(TSubclassOf<UObject> ManagerClass)
+{
+	JESTER_TRACE_SCOPE("Jester::GetManager");
+	JESTER_TRACE_COUNTER_INCREMENT(JesterManagerLookups);
+	JESTER_STAT_INC(ManagerLookups);
+
+	if(ManagerClass == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (UObject* Manager = FindManager(ManagerClass))
+	{
+		return Manager;
+	}
+	JESTER_STAT_INC(ManagerLookupMisses);
+	UE_LOG(LogJesterToolbox, Error, TEXT("Manager of type %s not found!"), *ManagerClass->GetName());
+	return nullptr;
+}
+
+UObject* UManagerLocatorSubsystem::FindManager(TSubclassOf<UObject> ManagerClass) const
 {
 	if(ManagerClass == nullptr)
 	{
@@ -90,10 +154,179 @@ UObject* UManagerLocatorSubsystem::GetManager(TSubclassOf<UObject> ManagerClass)
 			}
 		}
 	}
-	UE_LOG(LogJesterToolbox, Error, TEXT("Manager of type %s not found!"), *ManagerClass->GetName());
 	return nullptr;
 }
 
+UObject* UManagerLocatorSubsystem::GetManagerByInterface(UClass* Interface)
+{
+	JESTER_TRACE_SCOPE("Jester::GetManagerByInterface");
+	JESTER_TRACE_COUNTER_INCREMENT(JesterManagerLookups);
+	JESTER_STAT_INC(ManagerLookups);
+
+	if (Interface == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (UObject* Manager = FindManagerByInterface(Interface))
+	{
+		return Manager;
+	}
+	JESTER_STAT_INC(ManagerLookupMisses);
+	UE_LOG(LogJesterToolbox, Error, TEXT("No manager implements %s!"), *Interface->GetName());
+	return nullptr;
+}
+
+UObject* UManagerLocatorSubsystem::FindManagerByInterface(const UClass* Interface) const
+{
+	const TArray<UObject*, TInlineAllocator<1>>* Implementers = InterfaceImplementers.Find(Interface);
+	return Implementers != nullptr && Implementers->Num() > 0 ? (*Implementers)[0] : nullptr;
+}
+
+void UManagerLocatorSubsystem::RegisterManagerWithTag(UObject* Manager, FGameplayTag Key)
+{
+	if (!Key.IsValid())
+	{
+		UE_LOG(LogJesterToolbox, Error, TEXT("Manager %s needs a valid tag key"), *GetNameSafe(Manager));
+		return;
+	}
+	RegisterKeyedManager(Manager, Key.GetTagName(), INDEX_NONE);
+}
+
+void UManagerLocatorSubsystem::RegisterManagerWithIndex(UObject* Manager, int32 Key)
+{
+	RegisterKeyedManager(Manager, NAME_None, Key);
+}
+
+void UManagerLocatorSubsystem::RegisterKeyedManager(UObject* Manager, FName Tag, int32 Index)
+{
+	JESTER_LLM_SCOPE(Managers);
+	AActor* DestroyedSource = GetKeyedManagerActor(Manager);
+	if (DestroyedSource == nullptr)
+	{
+		UE_LOG(LogJesterToolbox, Error, TEXT("Manager %s must be an actor or an actor component"), *GetNameSafe(Manager));
+		return;
+	}
+
+	const UObject* ExistingManager = FindKeyedManager(Manager->GetClass(), Tag, Index);
+	if (ExistingManager != nullptr && ExistingManager != Manager)
+	{
+		UE_LOG(LogJesterToolbox, Error, TEXT("Manager %s is already registered with key %s!"),
+			*Manager->GetName(), Tag.IsNone() ? *FString::FromInt(Index) : *Tag.ToString());
+		return;
+	}
+
+	// Index the manager class and its parents so a lookup by a base class works like GetManager. Two child classes
+	// can share a key, the first one registered keeps the parent class entry until it is unregistered
+	for (const UClass* Class = Manager->GetClass(); Class != UObject::StaticClass(); Class = Class->GetSuperClass())
+	{
+		UObject*& KeyedManager = KeyedManagers.FindOrAdd({ Class, Tag, Index });
+		if (KeyedManager == nullptr)
+		{
+			KeyedManager = Manager;
+		}
+	}
+
+	if (!KeyedManagerObjects.Contains(Manager))
+	{
+		KeyedManagerObjects.Add(Manager);
+		AddToClassIndex(Manager);
+		DestroyedSource->OnDestroyed.AddUniqueDynamic(this, &UManagerLocatorSubsystem::HandleKeyedManagerDestroyed);
+		OnManagerRegistered.Broadcast(Manager);
+	}
+}
+
+void UManagerLocatorSubsystem::UnregisterKeyedManager(UObject* Manager)
+{
+	if (Manager == nullptr || KeyedManagerObjects.Remove(Manager) == 0)
+	{
+		return;
+	}
+
+	TArray<FManagerKey, TInlineAllocator<4>> FreedKeys;
+	for (auto It = KeyedManagers.CreateIterator(); It; ++It)
+	{
+		if (It.Value() == Manager)
+		{
+			FreedKeys.Add(It.Key());
+			It.RemoveCurrent();
+		}
+	}
+
+	// A parent class entry shared by several children goes to the earliest registered child still holding the key
+	for (const FManagerKey& Key : FreedKeys)
+	{
+		for (UObject* Other : KeyedManagerObjects)
+		{
+			if (Other->GetClass()->IsChildOf(Key.Class) && KeyedManagers.FindRef({ Other->GetClass(), Key.Tag, Key.Index }) == Other)
+			{
+				KeyedManagers.Add(Key, Other);
+				break;
+			}
+		}
+	}
+	RemoveFromClassIndex(Manager);
+
+	AActor* DestroyedSource = GetKeyedManagerActor(Manager);
+	const bool bSourceHasManagers = KeyedManagerObjects.ContainsByPredicate([DestroyedSource](UObject* Other) { return GetKeyedManagerActor(Other) == DestroyedSource; });
+	if (DestroyedSource != nullptr && !bSourceHasManagers)
+	{
+		DestroyedSource->OnDestroyed.RemoveDynamic(this, &UManagerLocatorSubsystem::HandleKeyedManagerDestroyed);
+	}
+}
+
+UObject* UManagerLocatorSubsystem::GetManagerByTag(TSubclassOf<UObject> ManagerClass, FGameplayTag Key) const
+{
+	JESTER_STAT_INC(ManagerLookups);
+	return FindKeyedManager(ManagerClass, Key.GetTagName(), INDEX_NONE);
+}
+
+UObject* UManagerLocatorSubsystem::GetManagerByIndex(TSubclassOf<UObject> ManagerClass, int32 Key) const
+{
+	JESTER_STAT_INC(ManagerLookups);
+	return FindKeyedManager(ManagerClass, NAME_None, Key);
+}
+
+UObject* UManagerLocatorSubsystem::FindKeyedManager(const UClass* ManagerClass, FName Tag, int32 Index) const
+{
+	UObject* const* Manager = KeyedManagers.Find({ ManagerClass, Tag, Index });
+	if (Manager == nullptr)
+	{
+		JESTER_STAT_INC(ManagerLookupMisses);
+		return nullptr;
+	}
+	return *Manager;
+}
+
+TConstArrayView<UObject*> UManagerLocatorSubsystem::GetAllManagersOfClass(TSubclassOf<UObject> ManagerClass) const
+{
+	const TArray<UObject*>* Managers = ManagersByClass.Find(ManagerClass.Get());
+	return Managers != nullptr ? TConstArrayView<UObject*>(*Managers) : TConstArrayView<UObject*>();
+}
+
+TArray<UObject*> UManagerLocatorSubsystem::CopyAllManagersOfClass(TSubclassOf<UObject> ManagerClass) const
+{
+	return TArray<UObject*>(GetAllManagersOfClass(ManagerClass));
+}
+
+void UManagerLocatorSubsystem::HandleKeyedManagerDestroyed(AActor* DestroyedActor)
+{
+	TArray<UObject*> ManagersToRemove;
+	for (UObject* Manager : KeyedManagerObjects)
+	{
+		const UActorComponent* Component = Cast<UActorComponent>(Manager);
+		if (Manager == DestroyedActor || (Component != nullptr && Component->GetOwner() == DestroyedActor))
+		{
+			ManagersToRemove.Add(Manager);
+		}
+	}
+
+	for (UObject* Manager : ManagersToRemove)
+	{
+		UnregisterKeyedManager(Manager);
+	}
+}
+
 void UManagerLocatorSubsystem::HandleComponentManagerOwnerDestroyed(AActor* Owner)
 {
 	TArray<UActorComponent*> ComponentsToRemove;
@@ -104,4 +337,56 @@ void UManagerLocatorSubsystem::HandleComponentManagerOwnerDestroyed(AActor* Owne
 			ComponentsToRemove.Add(Manager);
 		}
 	}
+
+	for (UActorComponent* Manager : ComponentsToRemove)
+	{
+		UnregisterComponentManager(Manager);
+	}
+}
+
+void UManagerLocatorSubsystem::AddToInterfaceIndex(UObject* Manager)
+{
+	for (const UClass* Class = Manager->GetClass(); Class != nullptr; Class = Class->GetSuperClass())
+	{
+		for (const FImplementedInterface& Implemented : Class->Interfaces)
+		{
+			// Interfaces can inherit from other interfaces, index the whole chain
+			for (const UClass* Interface = Implemented.Class; Interface != nullptr && Interface != UInterface::StaticClass(); Interface = Interface->GetSuperClass())
+			{
+				InterfaceImplementers.FindOrAdd(Interface).AddUnique(Manager);
+			}
+		}
+	}
+}
+
+void UManagerLocatorSubsystem::AddToClassIndex(UObject* Manager)
+{
+	for (const UClass* Class = Manager->GetClass(); Class != UObject::StaticClass(); Class = Class->GetSuperClass())
+	{
+		ManagersByClass.FindOrAdd(Class).Add(Manager);
+	}
+}
+
+void UManagerLocatorSubsystem::RemoveFromClassIndex(UObject* Manager)
+{
+	for (const UClass* Class = Manager->GetClass(); Class != UObject::StaticClass(); Class = Class->GetSuperClass())
+	{
+		if (TArray<UObject*>* Managers = ManagersByClass.Find(Class))
+		{
+			// Keep the registration order
+			Managers->RemoveSingle(Manager);
+		}
+	}
+}
+
+void UManagerLocatorSubsystem::RemoveFromInterfaceIndex(UObject* Manager)
+{
+	for (auto It = InterfaceImplementers.CreateIterator(); It; ++It)
+	{
+		It.Value().Remove(Manager);
+		if (It.Value().Num() == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
 }
@@ -0,0 +1,159 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Input/JesterInputRouterComponent.h"
+
+#include "EnhancedInputComponent.h"
+#include "InputAction.h"
+#include "JesterToolbox.h"
+#include "JesterToolboxMemory.h"
+#include "JesterToolboxTrace.h"
+#include "Engine/World.h"
+
+void UJesterInputRouterComponent::RegisterInputAction(FGameplayTag ActionTag, const UInputAction* Action)
+{
+	LLM_SCOPE_BYTAG(JesterToolbox);
+	if (Action == nullptr || TagToIndex.Contains(ActionTag))
+	{
+		UE_LOG(LogJesterToolbox, Error, TEXT("Can't register input action %s on %s, it's missing or already registered"),
+			*ActionTag.ToString(), *GetNameSafe(GetOwner()));
+		return;
+	}
+
+	const int32 ActionIndex = ActionStates.AddDefaulted();
+	ActionStates[ActionIndex].ActionTag = ActionTag;
+	ActionStates[ActionIndex].Action = Action;
+	TagToIndex.Add(ActionTag, ActionIndex);
+
+	if (InputComponent != nullptr)
+	{
+		BindAction(ActionIndex);
+	}
+}
+
+void UJesterInputRouterComponent::InitializeRouter(UEnhancedInputComponent* InInputComponent)
+{
+	check(InInputComponent != nullptr);
+	if (InputComponent == InInputComponent)
+	{
+		return;
+	}
+
+	// Moving to another input component, the previous one would keep calling the handlers
+	if (InputComponent != nullptr)
+	{
+		InputComponent->ClearBindingsForObject(this);
+	}
+	InputComponent = InInputComponent;
+	for (int32 ActionIndex = 0; ActionIndex < ActionStates.Num(); ++ActionIndex)
+	{
+		BindAction(ActionIndex);
+	}
+	UE_LOG(LogJesterToolbox, Verbose, TEXT("Input router of %s initialized with %d actions"), *GetNameSafe(GetOwner()), ActionStates.Num());
+}
+
+void UJesterInputRouterComponent::SetNotifiedEvents(FGameplayTag ActionTag, int32 EventMask)
+{
+	if (const int32* ActionIndex = TagToIndex.Find(ActionTag))
+	{
+		ActionStates[*ActionIndex].NotifiedEvents = EventMask;
+	}
+}
+
+bool UJesterInputRouterComponent::IsActionActive(FGameplayTag ActionTag) const
+{
+	const FJesterActionState* State = FindActionState(ActionTag);
+	return State != nullptr && State->bIsActive;
+}
+
+bool UJesterInputRouterComponent::WasActionTriggered(FGameplayTag ActionTag, float MaxTimeAgo) const
+{
+	const FJesterActionState* State = FindActionState(ActionTag);
+	return State != nullptr && WasRecent(State->LastTimeTriggered, MaxTimeAgo);
+}
+
+bool UJesterInputRouterComponent::WasActionActivated(FGameplayTag ActionTag, float MaxTimeAgo) const
+{
+	const FJesterActionState* State = FindActionState(ActionTag);
+	return State != nullptr && WasRecent(State->LastActivationStartTime, MaxTimeAgo);
+}
+
+bool UJesterInputRouterComponent::WasActionCompleted(FGameplayTag ActionTag, float MaxTimeAgo) const
+{
+	const FJesterActionState* State = FindActionState(ActionTag);
+	return State != nullptr && WasRecent(State->LastTimeCompleted, MaxTimeAgo);
+}
+
+int32 UJesterInputRouterComponent::GetActionIndex(FGameplayTag ActionTag) const
+{
+	const int32* ActionIndex = TagToIndex.Find(ActionTag);
+	return ActionIndex != nullptr ? *ActionIndex : INDEX_NONE;
+}
+
+FJesterActionState UJesterInputRouterComponent::GetActionState(int32 ActionIndex) const
+{
+	return ActionStates.IsValidIndex(ActionIndex) ? ActionStates[ActionIndex] : FJesterActionState();
+}
+
+const FJesterActionState* UJesterInputRouterComponent::FindActionState(FGameplayTag ActionTag) const
+{
+	const int32* ActionIndex = TagToIndex.Find(ActionTag);
+	return ActionIndex != nullptr ? &ActionStates[*ActionIndex] : nullptr;
+}
+
+void UJesterInputRouterComponent::BindAction(int32 ActionIndex)
+{
+	// The index rides along as a payload, the handlers don't have to look the action up
+	const UInputAction* Action = ActionStates[ActionIndex].Action;
+	InputComponent->BindAction(Action, ETriggerEvent::Started, this, &UJesterInputRouterComponent::HandleStarted, ActionIndex);
+	InputComponent->BindAction(Action, ETriggerEvent::Triggered, this, &UJesterInputRouterComponent::HandleTriggered, ActionIndex);
+	InputComponent->BindAction(Action, ETriggerEvent::Completed, this, &UJesterInputRouterComponent::HandleCompleted, ActionIndex);
+	InputComponent->BindAction(Action, ETriggerEvent::Canceled, this, &UJesterInputRouterComponent::HandleCanceled, ActionIndex);
+}
+
+void UJesterInputRouterComponent::HandleStarted(const FInputActionInstance& Instance, int32 ActionIndex)
+{
+	FJesterActionState& State = ActionStates[ActionIndex];
+	State.LastActivationStartTime = GetWorld()->GetTimeSeconds();
+	State.bIsActive = true;
+	UE_LOG(LogJesterToolbox, VeryVerbose, TEXT("Action %s started with value %s"), *State.ActionTag.ToString(), *Instance.GetValue().ToString());
+	Notify(State, EJesterActionEvent::Started);
+}
+
+void UJesterInputRouterComponent::HandleTriggered(const FInputActionInstance& Instance, int32 ActionIndex)
+{
+	// Fires every frame for held and analog inputs, keep it to the state update
+	FJesterActionState& State = ActionStates[ActionIndex];
+	State.LastTimeTriggered = GetWorld()->GetTimeSeconds();
+	Notify(State, EJesterActionEvent::Triggered);
+}
+
+void UJesterInputRouterComponent::HandleCompleted(const FInputActionInstance& Instance, int32 ActionIndex)
+{
+	FJesterActionState& State = ActionStates[ActionIndex];
+	State.LastTimeCompleted = GetWorld()->GetTimeSeconds();
+	State.bIsActive = false;
+	UE_LOG(LogJesterToolbox, VeryVerbose, TEXT("Action %s completed with value %s"), *State.ActionTag.ToString(), *Instance.GetValue().ToString());
+	Notify(State, EJesterActionEvent::Completed);
+}
+
+void UJesterInputRouterComponent::HandleCanceled(const FInputActionInstance& Instance, int32 ActionIndex)
+{
+	FJesterActionState& State = ActionStates[ActionIndex];
+	State.bIsActive = false;
+	UE_LOG(LogJesterToolbox, VeryVerbose, TEXT("Action %s cancelled with value %s"), *State.ActionTag.ToString(), *Instance.GetValue().ToString());
+	Notify(State, EJesterActionEvent::Canceled);
+}
+
+void UJesterInputRouterComponent::Notify(const FJesterActionState& State, EJesterActionEvent Event)
+{
+	if ((State.NotifiedEvents & static_cast<int32>(Event)) != 0)
+	{
+		JESTER_TRACE_SCOPE("Jester::InputRouter::Notify");
+		OnActionEvent.Broadcast(State.ActionTag, Event);
+	}
+}
+
+bool UJesterInputRouterComponent::WasRecent(float EventTime, float MaxTimeAgo) const
+{
+	return EventTime > 0.0f && GetWorld()->GetTimeSeconds() - EventTime <= MaxTimeAgo;
+}
@@ -5,15 +5,29 @@
 #include "AngelscriptCodeModule.h"
 #include "Core/ManagerActor.h"
 #include "Core/ManagerActorComponent.h"
+#include "JesterToolboxMemory.h"
+#include "JesterToolboxStats.h"
+#include "JesterToolboxTrace.h"
+#include "Misc/CoreDelegates.h"
 #include "Preprocessor/AngelscriptPreprocessor.h"
+#include "Utils/ScalableMultiChannelCurve.h"
 
 DEFINE_LOG_CATEGORY(LogJesterToolbox);
 
+#if CPUPROFILERTRACE_ENABLED
+UE_TRACE_CHANNEL_DEFINE(JesterToolboxChannel);
+#endif
+
 #define LOCTEXT_NAMESPACE "FJesterToolboxModule"
 
 void FJesterToolboxModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+	LLM_SCOPE_BYTAG(JesterToolbox);
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&JesterStats::EndFrame);
+#if WITH_EDITOR
+	ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddStatic(&FScalableMultiChannelCurve::HandleObjectPropertyChanged);
+#endif
 	
 	FAngelscriptCodeModule::GetClassAnalyze().BindLambda([](FString& GeneratedCode, TSharedPtr<struct FAngelscriptClassDesc> ClassDesc, bool& bHasStatics)
 	{
@@ -49,6 +63,10 @@ void FJesterToolboxModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+#endif
 }
 
 #undef LOCTEXT_NAMESPACE
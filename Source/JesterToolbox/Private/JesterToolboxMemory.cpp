@@ -0,0 +1,116 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "JesterToolboxMemory.h"
+
+#include "Core/AssetsLocatorService.h"
+#include "Core/JesterAssetSubsystem.h"
+#include "Core/JesterObjectPoolSubsystem.h"
+#include "Core/ManagerActor.h"
+#include "Core/ManagerActorComponent.h"
+#include "Core/ManagerLocatorSubsystem.h"
+#include "Serialization/ArchiveCountMem.h"
+#include "UObject/UObjectIterator.h"
+
+LLM_DEFINE_TAG(JesterToolbox);
+LLM_DEFINE_TAG(JesterToolbox_Managers);
+LLM_DEFINE_TAG(JesterToolbox_Assets);
+LLM_DEFINE_TAG(JesterToolbox_Curves);
+LLM_DEFINE_TAG(JesterToolbox_Capabilities);
+
+namespace JesterMemory
+{
+	namespace
+	{
+		thread_local int32 GToolboxScopeDepth = 0;
+
+		struct FSubsystem
+		{
+			const TCHAR* Name;
+			TArray<UClass*> NativeClasses;
+			// Script classes are looked up by name, they only exist once the scripts are compiled
+			TArray<const TCHAR*> ScriptClassNames;
+		};
+
+		struct FSubsystemUsage
+		{
+			TArray<UClass*> Classes;
+			int32 Instances = 0;
+			uint64 Bytes = 0;
+		};
+
+		TArray<FSubsystem> GetSubsystems()
+		{
+			return {
+				{ TEXT("Managers"), { AManagerActor::StaticClass(), UManagerActorComponent::StaticClass(), UManagerLocatorSubsystem::StaticClass() }, {} },
+				{ TEXT("Assets"), { UAssetsLocatorService::StaticClass(), UJesterAssetSubsystem::StaticClass() }, {} },
+				{ TEXT("Capabilities"), {}, { TEXT("Capability_AS"), TEXT("CapabilityNode_AS"), TEXT("CapabilitySystemComponent_AS"), TEXT("CapabilitySheet_AS") } },
+				{ TEXT("Pool"), { UJesterObjectPoolSubsystem::StaticClass() }, {} },
+				{ TEXT("Input"), {}, { TEXT("ActionManager_AS"), TEXT("StateTrackerComponent_AS") } },
+				{ TEXT("Logs"), {}, { TEXT("JesterLogManager_AS") } },
+			};
+		}
+	}
+
+	void Report(FOutputDevice& Ar)
+	{
+		const TArray<FSubsystem> Subsystems = GetSubsystems();
+		TArray<FSubsystemUsage> Usages;
+		Usages.SetNum(Subsystems.Num());
+		for (int32 i = 0; i < Subsystems.Num(); ++i)
+		{
+			Usages[i].Classes = Subsystems[i].NativeClasses;
+			for (const TCHAR* ScriptClassName : Subsystems[i].ScriptClassNames)
+			{
+				if (UClass* ScriptClass = FindObject<UClass>(ANY_PACKAGE, ScriptClassName))
+				{
+					Usages[i].Classes.Add(ScriptClass);
+				}
+			}
+		}
+
+		for (TObjectIterator<UObject> It(RF_ClassDefaultObject | RF_ArchetypeObject); It; ++It)
+		{
+			for (FSubsystemUsage& Usage : Usages)
+			{
+				if (Usage.Classes.ContainsByPredicate([&It](const UClass* Class) { return It->IsA(Class); }))
+				{
+					// Same count as 'obj list', includes the containers owned by the object (log rings, histories, maps)
+					FArchiveCountMem CountMem(*It);
+					Usage.Instances++;
+					Usage.Bytes += CountMem.GetMax();
+					break;
+				}
+			}
+		}
+
+		Ar.Logf(TEXT("%-16s %12s %16s"), TEXT("JesterToolbox"), TEXT("Instances"), TEXT("KB"));
+		for (int32 i = 0; i < Subsystems.Num(); ++i)
+		{
+			Ar.Logf(TEXT("%-16s %12d %16.2f"), Subsystems[i].Name, Usages[i].Instances, Usages[i].Bytes / 1024.0);
+		}
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+		Ar.Logf(TEXT("Native allocations (registry, locator maps, curve keys) are tagged under JesterToolbox in 'stat LLMFULL'"));
+#endif
+	}
+
+	void EnterToolboxScope()
+	{
+		++GToolboxScopeDepth;
+	}
+
+	void LeaveToolboxScope()
+	{
+		check(GToolboxScopeDepth > 0);
+		--GToolboxScopeDepth;
+	}
+
+	bool IsInToolboxScope()
+	{
+		return GToolboxScopeDepth > 0;
+	}
+
+	static FAutoConsoleCommandWithOutputDevice ReportMemoryCommand(
+		TEXT("Jester.Memory.Report"),
+		TEXT("Prints the memory used by the JesterToolbox objects alive and their instance count, per subsystem"),
+		FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&Report));
+}
@@ -0,0 +1,109 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "JesterToolboxStats.h"
+
+#include <atomic>
+
+DEFINE_STAT(STAT_JesterSpawn);
+DEFINE_STAT(STAT_JesterCopyObject);
+DEFINE_STAT(STAT_JesterManagerLookups);
+DEFINE_STAT(STAT_JesterManagerLookupMisses);
+DEFINE_STAT(STAT_JesterAssetLookups);
+DEFINE_STAT(STAT_JesterAssetStreamingRequests);
+DEFINE_STAT(STAT_JesterSpawnCalls);
+DEFINE_STAT(STAT_JesterCopyObjectCalls);
+DEFINE_STAT(STAT_JesterCapabilityUpdates);
+DEFINE_STAT(STAT_JesterActiveCapabilities);
+DEFINE_STAT(STAT_JesterAggregatorUpdates);
+DEFINE_STAT(STAT_JesterScheduledWorkRun);
+DEFINE_STAT(STAT_JesterSchedulerBudgetOverruns);
+DEFINE_STAT(STAT_JesterPendingInitializationEvents);
+DEFINE_STAT(STAT_JesterCapabilities);
+DEFINE_STAT(STAT_JesterPendingScheduledWork);
+DEFINE_STAT(STAT_JesterLocatorResidentBytes);
+
+namespace JesterStats
+{
+	namespace
+	{
+		constexpr int32 NumCounters = static_cast<int32>(ECounter::Num);
+		constexpr int32 FirstGaugeCounter = static_cast<int32>(ECounter::PendingInitializationEvents);
+
+		const TCHAR* CounterNames[NumCounters] =
+		{
+			TEXT("Manager Lookups"),
+			TEXT("Manager Lookup Misses"),
+			TEXT("Asset Lookups"),
+			TEXT("Asset Streaming Requests"),
+			TEXT("Spawn Calls"),
+			TEXT("Spawn Time (ms)"),
+			TEXT("CopyObject Calls"),
+			TEXT("CopyObject Time (ms)"),
+			TEXT("Capability Tree Updates"),
+			TEXT("Active Capabilities"),
+			TEXT("Aggregator Updates"),
+			TEXT("Scheduled Work Run"),
+			TEXT("Scheduler Budget Overruns"),
+			TEXT("Pending Initialization Events"),
+			TEXT("Capabilities"),
+			TEXT("Pending Scheduled Work"),
+			TEXT("Locator Resident Bytes"),
+		};
+
+		// Lookups can happen from worker threads, keep the counters atomic
+		std::atomic<int64> CurrentValues[NumCounters];
+		int64 LastFrameValues[NumCounters];
+		int64 TotalValues[NumCounters];
+
+		bool IsCycleCounter(int32 Index)
+		{
+			return Index == static_cast<int32>(ECounter::SpawnCycles) || Index == static_cast<int32>(ECounter::CopyObjectCycles);
+		}
+	}
+
+	void Add(ECounter Counter, int64 Delta)
+	{
+		CurrentValues[static_cast<int32>(Counter)].fetch_add(Delta, std::memory_order_relaxed);
+	}
+
+	void Set(ECounter Counter, int64 Value)
+	{
+		CurrentValues[static_cast<int32>(Counter)].store(Value, std::memory_order_relaxed);
+	}
+
+	void EndFrame()
+	{
+		for (int32 i = 0; i < FirstGaugeCounter; ++i)
+		{
+			LastFrameValues[i] = CurrentValues[i].exchange(0, std::memory_order_relaxed);
+			TotalValues[i] += LastFrameValues[i];
+		}
+	}
+
+	void Dump(FOutputDevice& Ar)
+	{
+		Ar.Logf(TEXT("%-32s %16s %16s"), TEXT("JesterToolbox"), TEXT("Last Frame"), TEXT("Total"));
+		for (int32 i = 0; i < FirstGaugeCounter; ++i)
+		{
+			if (IsCycleCounter(i))
+			{
+				Ar.Logf(TEXT("%-32s %16.3f %16.3f"), CounterNames[i],
+					FPlatformTime::ToMilliseconds64(LastFrameValues[i]), FPlatformTime::ToMilliseconds64(TotalValues[i]));
+			}
+			else
+			{
+				Ar.Logf(TEXT("%-32s %16lld %16lld"), CounterNames[i], LastFrameValues[i], TotalValues[i]);
+			}
+		}
+
+		for (int32 i = FirstGaugeCounter; i < NumCounters; ++i)
+		{
+			Ar.Logf(TEXT("%-32s %16lld"), CounterNames[i], CurrentValues[i].load(std::memory_order_relaxed));
+		}
+	}
+
+	static FAutoConsoleCommandWithOutputDevice DumpStatsCommand(
+		TEXT("Jester.Stats.Dump"),
+		TEXT("Prints the JesterToolbox counters of the last frame, same values as 'stat jestertoolbox'"),
+		FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&Dump));
+}
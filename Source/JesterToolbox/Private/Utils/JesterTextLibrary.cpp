@@ -0,0 +1,75 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Utils/JesterTextLibrary.h"
+
+void UJesterTextLibrary::Begin(const FString& Prefix)
+{
+	// Reset keeps the allocation
+	FString& Buffer = GetBuffer();
+	Buffer.Reset();
+	Buffer.Append(Prefix);
+}
+
+const FString& UJesterTextLibrary::Get()
+{
+	return GetBuffer();
+}
+
+void UJesterTextLibrary::Append(const FString& Text)
+{
+	GetBuffer().Append(Text);
+}
+
+void UJesterTextLibrary::AppendInt(int Value)
+{
+	GetBuffer().AppendInt(Value);
+}
+
+void UJesterTextLibrary::AppendFloat(float Value, int Decimals)
+{
+	// Formatted on the stack, FString::SanitizeFloat would allocate a string of its own
+	TCHAR Formatted[64];
+	FCString::Snprintf(Formatted, UE_ARRAY_COUNT(Formatted), TEXT("%.*f"), FMath::Clamp(Decimals, 0, 9), Value);
+	GetBuffer().Append(Formatted);
+}
+
+void UJesterTextLibrary::AppendBool(bool bValue)
+{
+	GetBuffer().Append(bValue ? TEXT("True") : TEXT("False"));
+}
+
+void UJesterTextLibrary::AppendVector(const FVector& Value)
+{
+	TCHAR Formatted[128];
+	FCString::Snprintf(Formatted, UE_ARRAY_COUNT(Formatted), TEXT("X=%3.3f Y=%3.3f Z=%3.3f"), Value.X, Value.Y, Value.Z);
+	GetBuffer().Append(Formatted);
+}
+
+void UJesterTextLibrary::AppendName(FName Name)
+{
+	Name.AppendString(GetBuffer());
+}
+
+void UJesterTextLibrary::AppendTag(FGameplayTag Tag)
+{
+	Tag.GetTagName().AppendString(GetBuffer());
+}
+
+void UJesterTextLibrary::AppendObjectName(const UObject* Object)
+{
+	if (Object != nullptr)
+	{
+		Object->GetFName().AppendString(GetBuffer());
+	}
+	else
+	{
+		GetBuffer().Append(TEXT("None"));
+	}
+}
+
+FString& UJesterTextLibrary::GetBuffer()
+{
+	check(IsInGameThread());
+	static FString Buffer;
+	return Buffer;
+}
@@ -0,0 +1,92 @@
+#include "Utils/JesterTrackedTagContainer.h"
+
+bool FJesterTrackedTagContainer::AddTag(const FGameplayTag& Tag)
+{
+	if (!Tag.IsValid() || Tags.HasTagExact(Tag))
+	{
+		return false;
+	}
+	Tags.AddTagFast(Tag);
+	LogChange(Tag, true);
+	return true;
+}
+
+bool FJesterTrackedTagContainer::RemoveTag(const FGameplayTag& Tag)
+{
+	if (!Tags.RemoveTag(Tag))
+	{
+		return false;
+	}
+	LogChange(Tag, false);
+	return true;
+}
+
+void FJesterTrackedTagContainer::AppendTags(const FGameplayTagContainer& Other)
+{
+	for (const FGameplayTag& Tag : Other)
+	{
+		AddTag(Tag);
+	}
+}
+
+void FJesterTrackedTagContainer::Reset()
+{
+	// Copy, RemoveTag changes the container
+	const TArray<FGameplayTag> OldTags = Tags.GetGameplayTagArray();
+	for (const FGameplayTag& Tag : OldTags)
+	{
+		RemoveTag(Tag);
+	}
+}
+
+bool FJesterTrackedTagContainer::GetChangesSince(int32& InOutGeneration, TArray<FGameplayTag>& OutAddedTags, TArray<FGameplayTag>& OutRemovedTags) const
+{
+	// Reset keeps the allocations of consumers that reuse their arrays every frame
+	OutAddedTags.Reset();
+	OutRemovedTags.Reset();
+	if (InOutGeneration < OldestLoggedGeneration || InOutGeneration > Generation)
+	{
+		InOutGeneration = Generation;
+		return false;
+	}
+
+	// The log is ordered, only the tail is newer than the consumer
+	int32 FirstChange = ChangeLog.Num();
+	while (FirstChange > 0 && ChangeLog[FirstChange - 1].Generation > InOutGeneration)
+	{
+		FirstChange--;
+	}
+
+	for (int32 i = FirstChange; i < ChangeLog.Num(); ++i)
+	{
+		const FJesterTagChange& Change = ChangeLog[i];
+		if (Change.bAdded)
+		{
+			// Removed then added back, the consumer never saw it go
+			if (OutRemovedTags.RemoveSingleSwap(Change.Tag) == 0)
+			{
+				OutAddedTags.Add(Change.Tag);
+			}
+		}
+		else if (OutAddedTags.RemoveSingleSwap(Change.Tag) == 0)
+		{
+			OutRemovedTags.Add(Change.Tag);
+		}
+	}
+
+	InOutGeneration = Generation;
+	return true;
+}
+
+void FJesterTrackedTagContainer::LogChange(const FGameplayTag& Tag, bool bAdded)
+{
+	Generation++;
+	if (ChangeLog.Num() >= MaxLoggedChanges)
+	{
+		// Drop the oldest half at once so the log isn't shifted on every change
+		const int32 NumDropped = MaxLoggedChanges / 2;
+		OldestLoggedGeneration = ChangeLog[NumDropped - 1].Generation;
+		ChangeLog.RemoveAt(0, NumDropped, false);
+	}
+	ChangeLog.Add({ Tag, bAdded, Generation });
+}
@@ -0,0 +1,187 @@
+#include "Utils/ScalableMultiChannelCurve.h"
+
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+	// Same as FRichCurve auto tangents without tension: slope between the neighbours, flat on extremes and end keys
+	float ComputeAutoTangent(float PrevTime, float PrevValue, float Value, float NextTime, float NextValue)
+	{
+		if ((PrevValue >= Value && NextValue >= Value) || (PrevValue <= Value && NextValue <= Value))
+		{
+			return 0.0f;
+		}
+		return (NextValue - PrevValue) / FMath::Max(NextTime - PrevTime, UE_KINDA_SMALL_NUMBER);
+	}
+}
+
+void FScalableMultiChannelCurve::AddKeyOrSetNormalized(float Time, const FVector4f& Value, ERichCurveInterpMode InterpMode)
+{
+	JESTER_LLM_SCOPE(Curves);
+	const int32 KeyIndex = Algo::LowerBoundBy(Keys, Time, &FScalableMultiChannelCurveKey::Time);
+	if (!Keys.IsValidIndex(KeyIndex) || !FMath::IsNearlyEqual(Keys[KeyIndex].Time, Time))
+	{
+		FScalableMultiChannelCurveKey Key;
+		Key.Time = Time;
+		Key.Value = Value;
+		Key.InterpMode = InterpMode;
+		Keys.Insert(Key, KeyIndex);
+	}
+	else
+	{
+		Keys[KeyIndex].Value = Value;
+		Keys[KeyIndex].InterpMode = InterpMode;
+	}
+
+	// The neighbours' auto tangents change as well
+	RebuildChannels();
+}
+
+void FScalableMultiChannelCurve::RebuildChannels()
+{
+	JESTER_LLM_SCOPE(Curves);
+	// The key search needs increasing times, the details panel lets keys be added anywhere
+	Algo::StableSortBy(Keys, &FScalableMultiChannelCurveKey::Time);
+
+	const int32 NumKeys = Keys.Num();
+	KeyTimes.SetNumUninitialized(NumKeys);
+	InterpModes.SetNumUninitialized(NumKeys);
+	for (FChannel& Channel : Channels)
+	{
+		Channel.Values.SetNumUninitialized(NumKeys);
+		Channel.ArriveTangents.SetNumUninitialized(NumKeys);
+		Channel.LeaveTangents.SetNumUninitialized(NumKeys);
+	}
+
+	for (int32 i = 0; i < NumKeys; ++i)
+	{
+		const FScalableMultiChannelCurveKey& Key = Keys[i];
+		KeyTimes[i] = Key.Time;
+		InterpModes[i] = Key.InterpMode;
+
+		const bool bAutoTangents = Key.TangentMode != RCTM_User && Key.TangentMode != RCTM_Break;
+		for (int32 c = 0; c < MaxChannels; ++c)
+		{
+			FChannel& Channel = Channels[c];
+			Channel.Values[i] = Key.Value[c];
+			if (!bAutoTangents)
+			{
+				Channel.ArriveTangents[i] = Key.ArriveTangent[c];
+				Channel.LeaveTangents[i] = Key.LeaveTangent[c];
+				continue;
+			}
+
+			const float Tangent = i > 0 && i < NumKeys - 1
+				? ComputeAutoTangent(Keys[i - 1].Time, Keys[i - 1].Value[c], Key.Value[c], Keys[i + 1].Time, Keys[i + 1].Value[c])
+				: 0.0f;
+			Channel.ArriveTangents[i] = Tangent;
+			Channel.LeaveTangents[i] = Tangent;
+		}
+	}
+}
+
+void FScalableMultiChannelCurve::PostSerialize(const FArchive& Ar)
+{
+	if (Ar.IsLoading())
+	{
+		RebuildChannels();
+	}
+}
+
+#if WITH_EDITOR
+void FScalableMultiChannelCurve::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	if (Object == nullptr)
+	{
+		return;
+	}
+
+	// Structs don't get PostEditChangeProperty, so every curve of the edited object is rebuilt
+	for (TPropertyValueIterator<FStructProperty> It(Object->GetClass(), Object); It; ++It)
+	{
+		if (It.Key()->Struct == StaticStruct())
+		{
+			static_cast<FScalableMultiChannelCurve*>(const_cast<void*>(It.Value()))->RebuildChannels();
+		}
+	}
+}
+#endif
+
+void FScalableMultiChannelCurve::EvaluateBatch(TConstArrayView<float> InTimes, TArrayView<FVector4f> OutValues) const
+{
+	check(InTimes.Num() == OutValues.Num());
+	int32 Segment = INDEX_NONE;
+	for (int32 i = 0; i < InTimes.Num(); ++i)
+	{
+		const float NormalizedTime = InTimes[i] / ScaleX;
+		if (Segment == INDEX_NONE || NormalizedTime < KeyTimes[Segment])
+		{
+			Segment = FindSegment(NormalizedTime);
+		}
+		else
+		{
+			// Increasing times, move forward from the previous segment
+			while (Segment + 1 < KeyTimes.Num() && KeyTimes[Segment + 1] <= NormalizedTime)
+			{
+				Segment++;
+			}
+		}
+		OutValues[i] = EvaluateSegment(NormalizedTime, Segment);
+	}
+}
+
+int32 FScalableMultiChannelCurve::FindSegment(float NormalizedTime) const
+{
+	return Algo::UpperBound(KeyTimes, NormalizedTime) - 1;
+}
+
+FVector4f FScalableMultiChannelCurve::EvaluateSegment(float NormalizedTime, int32 Segment) const
+{
+	const int32 NumKeys = KeyTimes.Num();
+	if (NumKeys == 0)
+	{
+		return FVector4f(0.0f, 0.0f, 0.0f, 0.0f);
+	}
+
+	FVector4f Value;
+	if (Segment == INDEX_NONE || Segment == NumKeys - 1 || InterpModes[Segment] == RCIM_Constant || InterpModes[Segment] == RCIM_None)
+	{
+		// Constant before the first key and after the last one, like the default FRichCurve extrapolation
+		const int32 KeyIndex = FMath::Max(Segment, 0);
+		for (int32 c = 0; c < MaxChannels; ++c)
+		{
+			Value[c] = Channels[c].Values[KeyIndex];
+		}
+	}
+	else if (InterpModes[Segment] == RCIM_Linear)
+	{
+		const float Alpha = (NormalizedTime - KeyTimes[Segment]) / (KeyTimes[Segment + 1] - KeyTimes[Segment]);
+		for (int32 c = 0; c < MaxChannels; ++c)
+		{
+			Value[c] = FMath::Lerp(Channels[c].Values[Segment], Channels[c].Values[Segment + 1], Alpha);
+		}
+	}
+	else
+	{
+		// Bezier with the control points FRichCurve places a third of the segment away along the tangents
+		const float Duration = KeyTimes[Segment + 1] - KeyTimes[Segment];
+		const float Alpha = (NormalizedTime - KeyTimes[Segment]) / Duration;
+		const float InvAlpha = 1.0f - Alpha;
+		const float W0 = InvAlpha * InvAlpha * InvAlpha;
+		const float W1 = 3.0f * InvAlpha * InvAlpha * Alpha;
+		const float W2 = 3.0f * InvAlpha * Alpha * Alpha;
+		const float W3 = Alpha * Alpha * Alpha;
+		for (int32 c = 0; c < MaxChannels; ++c)
+		{
+			const FChannel& Channel = Channels[c];
+			const float P0 = Channel.Values[Segment];
+			const float P3 = Channel.Values[Segment + 1];
+			const float P1 = P0 + Channel.LeaveTangents[Segment] * Duration / 3.0f;
+			const float P2 = P3 - Channel.ArriveTangents[Segment + 1] * Duration / 3.0f;
+			Value[c] = W0 * P0 + W1 * P1 + W2 * P2 + W3 * P3;
+		}
+	}
+	return Value * ChannelScales;
+}
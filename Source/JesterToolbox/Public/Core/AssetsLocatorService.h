@@ -20,6 +20,37 @@ struct FAssetCategory
 	TMap<FGameplayTag, TSubclassOf<UObject>> Classes;
 };
 
+/**
+ * Immutable copy of the locator tables that any thread can read without locks. Published by the asset subsystem when
+ * its locator initializes, see UAssetsLocatorService::GetPublishedSnapshot.
+ * A snapshot lives as long as someone holds it and keeps its assets from being collected until then, so keep the
+ * pointer for the duration of the job and drop it after.
+ */
+class JESTERTOOLBOX_API FJesterAssetsSnapshot
+{
+public:
+	// nullptr when the tag isn't registered or the asset isn't an ExpectedClass
+	UObject* FindAsset(const FGameplayTag& Tag, const UClass* ExpectedClass = nullptr) const;
+	UClass* FindClass(const FGameplayTag& Tag, const UClass* ExpectedClass = nullptr) const;
+
+	template<typename T>
+	T* FindAsset(const FGameplayTag& Tag) const
+	{
+		return static_cast<T*>(FindAsset(Tag, T::StaticClass()));
+	}
+
+	uint32 GetGeneration() const { return Generation; }
+
+private:
+	friend class UAssetsLocatorService;
+
+	TMap<FGameplayTag, UObject*> Assets;
+	TMap<FGameplayTag, UClass*> Classes;
+	uint32 Generation = 0;
+};
+
+using FJesterAssetsSnapshotPtr = TSharedPtr<const FJesterAssetsSnapshot, ESPMode::ThreadSafe>;
+
 /**
  * 
  */
@@ -39,6 +70,25 @@ public:
 	
 	UFUNCTION(BlueprintPure, meta=(AutoCreateRefTerm="Tag"))
 	TSoftObjectPtr<UWorld> GetLevel(const FGameplayTag& Tag) const;
+
+	// Changes every time a locator flattens its tables, FJesterAssetRef resolves again when it does
+	static uint32 GetGeneration();
+	static void BumpGeneration();
+
+	// Copies the tables to a new snapshot and makes it the one worker threads see. Game thread only
+	void PublishSnapshot() const;
+	static void ClearPublishedSnapshot();
+
+	// Safe from any thread, nullptr until a locator got published
+	static FJesterAssetsSnapshotPtr GetPublishedSnapshot();
+
+#if WITH_EDITOR
+	// Picks up edits of the class defaults, only the categories that changed are flattened again
+	void RefreshFromDefaults();
+
+	// Used when the service gets reinstanced, so the refresh that follows stays incremental
+	void CopyFlattenedTables(const UAssetsLocatorService& Previous);
+#endif
 	
 protected:
 	// Split in categories to organize assets better but they are meaningless, will get flattened in the end
@@ -53,4 +103,15 @@ protected:
 	TMap<FGameplayTag, TSubclassOf<UObject>> Classes;
 
 	bool bInitialized;
+
+private:
+	void AddCategory(const FAssetCategory& Category);
+	// Looks the tags up again in every category, the last category in RegisteredAssets order wins like in Initialize
+	void ResolveTags(const TSet<FGameplayTag>& AssetTags, const TSet<FGameplayTag>& ClassTags);
+	void UpdateResidentBytes();
+
+	static uint32 HashCategory(const FAssetCategory& Category);
+
+	// Hash of each category when it was last flattened, tells which ones changed on refresh
+	TMap<FString, uint32> CategoryHashes;
 };
@@ -73,7 +73,16 @@ public:
 protected:
 	UPROPERTY(BlueprintReadWrite, meta=(Categories = "GameStateInitialization"))
 	TArray<FGameplayTag> OrderedInitializationSteps;
+
+	// Steps whose results survive seamless travel, the next game state skips them if they lead the chain
+	UPROPERTY(BlueprintReadWrite, meta=(Categories = "GameStateInitialization"))
+	FGameplayTagContainer PersistentInitializationSteps;
 	
 	TArray<FGameStateInitializationEvent> InitializationEvents;
 	int InitializationIndex = 0;
+
+private:
+	void SkipCheckpointedSteps();
+	void TriggerPendingEvents();
+	void CompleteInitialization();
 };
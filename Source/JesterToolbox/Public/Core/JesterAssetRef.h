@@ -0,0 +1,65 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Core/AssetsLocatorService.h"
+#include "JesterAssetRef.generated.h"
+
+/**
+ * Asset of the AssetsLocatorService authored by tag. Resolved on first access and cached with the locator generation,
+ * so until the locator changes an access is a pointer read instead of a GetAsset lookup.
+ */
+USTRUCT(BlueprintType)
+struct JESTERTOOLBOX_API FJesterAssetRef
+{
+	GENERATED_BODY()
+
+	FJesterAssetRef() = default;
+	explicit FJesterAssetRef(const FGameplayTag& InTag) : Tag(InTag) {}
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(Categories = "Asset.Data"))
+	FGameplayTag Tag;
+
+	// ExpectedClass is checked on every access like GetAsset does, nullptr when the asset isn't one
+	UObject* Get(const UClass* ExpectedClass = nullptr) const
+	{
+		if (CachedGeneration != UAssetsLocatorService::GetGeneration())
+		{
+			Resolve();
+		}
+		if (ExpectedClass != nullptr && CachedAsset != nullptr && !CachedAsset->IsA(ExpectedClass))
+		{
+			ReportUnexpectedClass(ExpectedClass);
+			return nullptr;
+		}
+		return CachedAsset;
+	}
+
+	template<typename T>
+	T* Get() const
+	{
+		return Cast<T>(Get(T::StaticClass()));
+	}
+
+	bool IsSet() const { return Tag.IsValid(); }
+
+private:
+	void Resolve() const;
+	void ReportUnexpectedClass(const UClass* ExpectedClass) const;
+
+	// Kept alive by the locator, dropped as soon as its generation changes
+	mutable UObject* CachedAsset = nullptr;
+	mutable uint32 CachedGeneration = 0;
+};
+
+/** Typed FJesterAssetRef for native code, UPROPERTYs use FJesterAssetRef and Get<T> */
+template<typename T>
+struct TJesterAssetRef : public FJesterAssetRef
+{
+	using FJesterAssetRef::FJesterAssetRef;
+
+	T* Get() const { return FJesterAssetRef::Get<T>(); }
+	T* operator->() const { return Get(); }
+};
@@ -21,8 +21,16 @@ public:
 	UAssetsLocatorService* GetAssetsLocatorService() const { return AssetsLocatorService; }
 
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
 
 private:
+#if WITH_EDITOR
+	// Keep the service in sync with its blueprint while designers iterate on it
+	void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+	void HandleObjectsReplaced(const TMap<UObject*, UObject*>& ReplacedObjects);
+	void RefreshAssetsLocatorService();
+#endif
+
 	UPROPERTY()
 	UAssetsLocatorService* AssetsLocatorService = nullptr;
 };
\ No newline at end of file
@@ -0,0 +1,54 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "JesterAsyncLibrary.generated.h"
+
+class UGameStateInitialization;
+class UJesterAwaitable;
+
+/**
+ * Awaitables for the things script used to poll for every tick. Chain the follow up with Then:
+ * JesterAsync::WaitForManager(UMyManager).Then(FJesterAwaitableContinuation(this, n"OnManagerReady"));
+ */
+UCLASS()
+class JESTERTOOLBOX_API UJesterAsyncLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "Jester|Async", meta = (WorldContext = "WorldContextObject"))
+	static UJesterAwaitable* Delay(UObject* WorldContextObject, float Seconds);
+
+	// Completes with the manager once it is registered to the locator
+	UFUNCTION(BlueprintCallable, Category = "Jester|Async", meta = (WorldContext = "WorldContextObject"))
+	static UJesterAwaitable* WaitForManager(UObject* WorldContextObject, TSubclassOf<UObject> ManagerClass);
+
+	UFUNCTION(BlueprintCallable, Category = "Jester|Async")
+	static UJesterAwaitable* WaitForInitializationStep(UGameStateInitialization* Initialization, FGameplayTag Step, bool bIsPostState = false);
+
+	// Completes with the loaded asset, streamed in asynchronously if needed
+	UFUNCTION(BlueprintCallable, Category = "Jester|Async", meta = (WorldContext = "WorldContextObject"))
+	static UJesterAwaitable* LoadAsset(UObject* WorldContextObject, TSoftObjectPtr<UObject> Asset);
+
+	UFUNCTION(BlueprintCallable, Category = "Jester|Async", meta = (WorldContext = "WorldContextObject"))
+	static UJesterAwaitable* LoadClass(UObject* WorldContextObject, TSoftClassPtr<UObject> Class);
+
+	// Streams all the assets in with a single request, completes once every one of them is resident
+	UFUNCTION(BlueprintCallable, Category = "Jester|Async", meta = (WorldContext = "WorldContextObject"))
+	static UJesterAwaitable* LoadAssetBatch(UObject* WorldContextObject, const TArray<FSoftObjectPath>& Assets);
+
+	// Completes once all the awaitables completed, cancelled as soon as one of them is
+	UFUNCTION(BlueprintCallable, Category = "Jester|Async", meta = (WorldContext = "WorldContextObject"))
+	static UJesterAwaitable* WhenAll(UObject* WorldContextObject, const TArray<UJesterAwaitable*>& Awaitables);
+
+	// Runs Work on a worker thread, the awaitable completes on the game thread once it's done
+	static UJesterAwaitable* RunOnWorkerThread(UObject* WorldContextObject, TFunction<void()>&& Work);
+
+private:
+	static UJesterAwaitable* CreateAwaitable(UObject* WorldContextObject);
+	static UJesterAwaitable* LoadAsync(UObject* WorldContextObject, const FSoftObjectPath& Path);
+};
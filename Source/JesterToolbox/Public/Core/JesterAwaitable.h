@@ -0,0 +1,98 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "JesterAwaitable.generated.h"
+
+class UJesterAwaitable;
+
+DECLARE_DYNAMIC_DELEGATE_OneParam(FJesterAwaitableContinuation, UJesterAwaitable*, Awaitable);
+
+UENUM(BlueprintType)
+enum class EJesterAwaitableState : uint8
+{
+	Pending,
+	Completed,
+	Cancelled
+};
+
+/**
+ * Result of an asynchronous operation (delay, manager availability, initialization step, asset load...).
+ * Continuations added with Then run on the game thread once it completes, right away if it already did, and never if
+ * it gets cancelled. Created through UJesterAsyncLibrary, pending awaitables are kept alive by their world.
+ */
+UCLASS(BlueprintType)
+class JESTERTOOLBOX_API UJesterAwaitable : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "Jester|Async")
+	UJesterAwaitable* Then(FJesterAwaitableContinuation Continuation);
+
+	UJesterAwaitable* Then(TFunction<void(UJesterAwaitable*)>&& Continuation);
+
+	// Runs when the awaitable is cancelled, right away if it already was
+	UJesterAwaitable* OnCancelled(TFunction<void(UJesterAwaitable*)>&& Callback);
+
+	UFUNCTION(BlueprintPure, Category = "Jester|Async")
+	EJesterAwaitableState GetState() const { return State; }
+
+	UFUNCTION(BlueprintPure, Category = "Jester|Async")
+	bool IsDone() const { return State != EJesterAwaitableState::Pending; }
+
+	// Loaded asset, manager... depending on what was awaited, can be null
+	UFUNCTION(BlueprintPure, Category = "Jester|Async")
+	UObject* GetResult() const { return Result; }
+
+	// Completes the awaitable and runs the continuations, does nothing if it's already done. Game thread only
+	UFUNCTION(BlueprintCallable, Category = "Jester|Async")
+	void Complete(UObject* InResult = nullptr);
+
+	UFUNCTION(BlueprintCallable, Category = "Jester|Async")
+	void Cancel();
+
+	// Called once when the awaitable completes or is cancelled, used to release whatever it was waiting on.
+	// Runs right away when the awaitable is already done, a request can complete before its cleanup is set
+	void SetCleanup(TFunction<void()>&& InCleanup);
+
+private:
+	friend class UJesterAsyncLibrary;
+
+	// Target for the events that call a function by name
+	UFUNCTION()
+	void CompleteFromEvent();
+
+	void Finish(EJesterAwaitableState NewState);
+
+	UPROPERTY()
+	UObject* Result = nullptr;
+
+	EJesterAwaitableState State = EJesterAwaitableState::Pending;
+	TArray<FJesterAwaitableContinuation> Continuations;
+	TArray<TFunction<void(UJesterAwaitable*)>> NativeContinuations;
+	TArray<TFunction<void(UJesterAwaitable*)>> CancelCallbacks;
+	TFunction<void()> Cleanup;
+};
+
+/**
+ * Owns the pending awaitables of a world so they survive GC while waiting, and cancels them when the world goes away.
+ */
+UCLASS()
+class JESTERTOOLBOX_API UJesterAsyncSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UJesterAwaitable* CreateAwaitable();
+
+	virtual void Deinitialize() override;
+
+private:
+	friend class UJesterAwaitable;
+
+	UPROPERTY()
+	TSet<UJesterAwaitable*> PendingAwaitables;
+};
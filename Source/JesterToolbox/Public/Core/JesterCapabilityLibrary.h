@@ -0,0 +1,21 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "JesterCapabilityLibrary.generated.h"
+
+/**
+ * Native helpers for the script capability system
+ */
+UCLASS()
+class JESTERTOOLBOX_API UJesterCapabilityLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	// Takes a capability or capability node from the world's object pool (or creates it) and tags the allocations for the low level memory tracker
+	UFUNCTION(ScriptCallable, Category="Capabilities", meta=(DeterminesOutputType = "CapabilityClass"))
+	static UObject* AcquireCapabilityObject(UObject* Outer, TSubclassOf<UObject> CapabilityClass);
+};
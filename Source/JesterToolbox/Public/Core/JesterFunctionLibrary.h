@@ -80,6 +80,10 @@ public:
 	UFUNCTION(ScriptCallable, Category="Core", meta=(DeterminesOutputType="ClassToSpawn"))
 	static AActor* SpawnActor(const TSubclassOf<AActor>& ClassToSpawn, const FVector& Location, const FRotator& Rotation = FRotator::ZeroRotator, ESpawnActorCollisionHandlingMethod SpawnActorCollisionHandling = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn, const FName& Name = NAME_None, bool bDeferredSpawn = false, ULevel* Level = nullptr);
 
+	// Clones a constructed archetype of the class instead of running its construction scripts, see UJesterSpawnTemplateSubsystem
+	UFUNCTION(ScriptCallable, Category="Core", meta=(DeterminesOutputType="ClassToSpawn"))
+	static AActor* SpawnActorFromTemplate(const TSubclassOf<AActor>& ClassToSpawn, const FVector& Location, const FRotator& Rotation = FRotator::ZeroRotator, ULevel* Level = nullptr);
+
 	UFUNCTION(ScriptCallable, Category="Core")
 	static AActor* FinishSpawningActor(AActor* Actor, FTransform Transform, ESpawnActorScaleMethod ScaleMethod = ESpawnActorScaleMethod::MultiplyWithRoot);
 	
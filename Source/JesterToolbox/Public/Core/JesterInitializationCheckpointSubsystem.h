@@ -0,0 +1,39 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "JesterInitializationCheckpointSubsystem.generated.h"
+
+/**
+ * Remembers the persistent initialization steps a UGameStateInitialization completed, so the game state of the next
+ * level can skip them after a seamless travel. A hard travel drops the checkpoint since nothing survives it.
+ */
+UCLASS()
+class JESTERTOOLBOX_API UJesterInitializationCheckpointSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	void RecordCompletedStep(const UWorld* World, FGameplayTag Step);
+
+	// Steps completed before the seamless travel that led to World, empty when World wasn't reached seamlessly
+	FGameplayTagContainer ConsumeCheckpoint(const UWorld* World);
+
+	UFUNCTION(BlueprintCallable, Category = "Jester|Initialization")
+	void ClearCheckpoint();
+
+private:
+	void HandleSeamlessTravel(UWorld* World);
+
+	FGameplayTagContainer CompletedSteps;
+
+	// World the checkpoint belongs to, the steps stay valid in it and in the worlds seamless travel leads to
+	TWeakObjectPtr<const UWorld> CheckpointWorld;
+	bool bSeamlessTravelPending = false;
+};
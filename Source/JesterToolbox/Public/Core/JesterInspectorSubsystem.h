@@ -0,0 +1,37 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "JesterInspectorSubsystem.generated.h"
+
+class FJesterInspectorServer;
+
+/**
+ * Serves the debug data the ImGui windows show as JSON on a loopback HTTP port, for servers that don't render.
+ * Off by default: start it with -JesterInspectorPort=<Port> or Jester.Inspector.Start <Port>. Not compiled in shipping.
+ *
+ *   /jester          minimal viewer page
+ *   /jester/actors   actors of every game world, ?class= filters by class name
+ *   /jester/actor    ?name= properties of an actor, of its components and of the objects they point to that aren't assets,
+ *                    actors or subsystems (capability trees, aggregators, log histories...)
+ *   /jester/objects  ?class= properties of the live objects of a class, subsystems and log managers for instance
+ */
+UCLASS()
+class JESTERTOOLBOX_API UJesterInspectorSubsystem : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	bool StartInspector(uint32 Port);
+	void StopInspector();
+	bool IsRunning() const;
+
+private:
+	// Keeps the HTTP server types out of this header, null in shipping
+	TSharedPtr<FJesterInspectorServer> Server;
+};
@@ -0,0 +1,24 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "JesterMemoryLibrary.generated.h"
+
+/**
+ * Lets the script layer mark its per frame entry points as toolbox work, see JesterMemory::FToolboxScope
+ */
+UCLASS()
+class JESTERTOOLBOX_API UJesterMemoryLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	// Every Enter needs its Leave on the same thread, in the same frame
+	UFUNCTION(ScriptCallable, Category="Memory")
+	static void EnterToolboxScope();
+
+	UFUNCTION(ScriptCallable, Category="Memory")
+	static void LeaveToolboxScope();
+};
@@ -0,0 +1,99 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/Interface.h"
+#include "JesterObjectPoolSubsystem.generated.h"
+
+UINTERFACE(MinimalAPI, Blueprintable)
+class UJesterPoolable : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Reset hooks for objects going through the UJesterObjectPoolSubsystem, optional.
+ */
+class JESTERTOOLBOX_API IJesterPoolable
+{
+	GENERATED_BODY()
+
+public:
+	// Called when the object is taken from the pool, after it got its new outer
+	UFUNCTION(BlueprintNativeEvent, Category = "Jester|Pool")
+	void OnAcquiredFromPool();
+	virtual void OnAcquiredFromPool_Implementation() {}
+
+	// Called when the object goes back to the pool, before its properties are reset to the class defaults.
+	// Release anything held outside of its properties here
+	UFUNCTION(BlueprintNativeEvent, Category = "Jester|Pool")
+	void OnReturnedToPool();
+	virtual void OnReturnedToPool_Implementation() {}
+};
+
+USTRUCT()
+struct FJesterObjectPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<UObject*> FreeObjects;
+
+	// INDEX_NONE uses the subsystem default
+	int32 MaxPooledObjects = INDEX_NONE;
+};
+
+/**
+ * Pool of reusable UObjects, per class. Acquire hands out a pooled object (renamed into the requested outer) or creates
+ * a new one, Release resets the object and keeps it for the next Acquire unless the class is at its cap, in which case
+ * the object is left to the GC. Resetting copies every reflected property from the class defaults, native members that
+ * aren't properties are up to OnReturnedToPool.
+ * Saves the NewObject cost and the GC churn of objects that are rebuilt often, like capability trees on respawn.
+ */
+UCLASS()
+class JESTERTOOLBOX_API UJesterObjectPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "Jester|Pool", meta=(DeterminesOutputType = "ObjectClass"))
+	UObject* Acquire(TSubclassOf<UObject> ObjectClass, UObject* Outer);
+
+	template<typename T>
+	T* Acquire(UObject* Outer, TSubclassOf<T> ObjectClass = T::StaticClass())
+	{
+		return CastChecked<T>(Acquire(TSubclassOf<UObject>(ObjectClass), Outer), ECastCheckedType::NullAllowed);
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "Jester|Pool")
+	void Release(UObject* Object);
+
+	// Creates objects until the pool of ObjectClass holds Count of them (or reaches its cap)
+	UFUNCTION(BlueprintCallable, Category = "Jester|Pool")
+	void Prewarm(TSubclassOf<UObject> ObjectClass, int32 Count);
+
+	// Max number of free objects kept for ObjectClass, INDEX_NONE goes back to DefaultMaxPooledObjects
+	UFUNCTION(BlueprintCallable, Category = "Jester|Pool")
+	void SetMaxPooledObjects(TSubclassOf<UObject> ObjectClass, int32 MaxPooledObjects);
+
+	UFUNCTION(BlueprintPure, Category = "Jester|Pool")
+	int32 GetNumPooledObjects(TSubclassOf<UObject> ObjectClass) const;
+
+	// Drops every pooled object, they will be collected by the next GC
+	UFUNCTION(BlueprintCallable, Category = "Jester|Pool")
+	void EmptyPools();
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Jester|Pool")
+	int32 DefaultMaxPooledObjects = 64;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	int32 GetMaxPooledObjects(const FJesterObjectPool& Pool) const;
+
+	UPROPERTY()
+	TMap<UClass*, FJesterObjectPool> Pools;
+};
@@ -0,0 +1,57 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "JesterParallelLibrary.generated.h"
+
+class UJesterAwaitable;
+
+DECLARE_DYNAMIC_DELEGATE_OneParam(FJesterParallelForBody, int32, Index);
+DECLARE_DYNAMIC_DELEGATE_RetVal_OneParam(float, FJesterParallelForFloatBody, int32, Index);
+DECLARE_DYNAMIC_DELEGATE_RetVal_OneParam(int32, FJesterParallelForIntBody, int32, Index);
+DECLARE_DYNAMIC_DELEGATE_RetVal_OneParam(FVector, FJesterParallelForVectorBody, int32, Index);
+DECLARE_DYNAMIC_DELEGATE(FJesterTaskBody);
+
+/**
+ * Worker thread helpers for script kernels. The bound function has to be marked thread safe
+ * (UFUNCTION(Meta = (BlueprintThreadSafe))), functions that aren't marked run on the game thread instead, with an error.
+ * Kernels only read their object, they never write to it or to any other UObject. To produce data, use the
+ * ParallelFor variants with results: the kernel returns its value and the library stores it at its index in OutResults.
+ * Outside of shipping builds the bound object is checked for modifications after running the kernel.
+ */
+UCLASS()
+class JESTERTOOLBOX_API UJesterParallelLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	// Calls Body for every index in [0, Num) across the worker threads and returns once they all ran
+	UFUNCTION(BlueprintCallable, Category = "Jester|Parallel")
+	static void ParallelFor(int32 Num, FJesterParallelForBody Body);
+
+	// ParallelFor where OutResults[Index] is what Body returned for Index. OutResults is only assigned after every
+	// kernel finished, so it can be a member of the bound object
+	UFUNCTION(BlueprintCallable, Category = "Jester|Parallel")
+	static void ParallelForFloat(int32 Num, FJesterParallelForFloatBody Body, TArray<float>& OutResults);
+
+	UFUNCTION(BlueprintCallable, Category = "Jester|Parallel")
+	static void ParallelForInt(int32 Num, FJesterParallelForIntBody Body, TArray<int32>& OutResults);
+
+	UFUNCTION(BlueprintCallable, Category = "Jester|Parallel")
+	static void ParallelForVector(int32 Num, FJesterParallelForVectorBody Body, TArray<FVector>& OutResults);
+
+	// Runs Body on a worker thread, the awaitable completes on the game thread
+	UFUNCTION(BlueprintCallable, Category = "Jester|Parallel", meta = (WorldContext = "WorldContextObject"))
+	static UJesterAwaitable* SpawnTask(UObject* WorldContextObject, FJesterTaskBody Body);
+
+	// True while running a kernel on a worker thread, for native code called from kernels to assert on
+	static bool IsInWorkerKernel();
+
+private:
+	static bool CanRunOnWorkers(const UObject* Object, FName FunctionName);
+
+	template<typename TDelegate, typename TKernel>
+	static void RunKernel(int32 Num, const TDelegate& Body, TKernel Kernel);
+};
@@ -0,0 +1,110 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "JesterSchedulerSubsystem.generated.h"
+
+DECLARE_DYNAMIC_DELEGATE(FJesterDeferredWork);
+
+UENUM(BlueprintType)
+enum class EJesterWorkPriority : uint8
+{
+	High,
+	Normal,
+	Low,
+
+	MAX UMETA(Hidden)
+};
+
+USTRUCT(BlueprintType)
+struct FJesterWorkHandle
+{
+	GENERATED_BODY()
+
+	bool IsValid() const { return Id != 0; }
+
+	UPROPERTY()
+	int32 Id = 0;
+};
+
+/**
+ * Spreads deferred work over frames. Every priority lane gets its own time budget per frame, lanes run from High to Low.
+ * Inside a lane, work with a deadline runs first (earliest deadline first), then the rest in the order it was scheduled.
+ * Work that reached its deadline, or that waited more than MaxWaitFrames, runs even when the lane is out of budget so
+ * nothing gets starved by a busy lane.
+ */
+UCLASS()
+class JESTERTOOLBOX_API UJesterSchedulerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Queues Work to run on a later frame.
+	 * @param DeadlineSeconds Time from now by which the work has to run regardless of the budget, negative for no deadline
+	 */
+	FJesterWorkHandle Schedule(TFunction<void()>&& Work, EJesterWorkPriority Priority = EJesterWorkPriority::Normal, float DeadlineSeconds = -1.0f);
+
+	UFUNCTION(BlueprintCallable, Category = "Jester|Scheduler", meta=(DisplayName = "Schedule", ScriptName = "Schedule"))
+	FJesterWorkHandle ScheduleDelegate(FJesterDeferredWork Work, EJesterWorkPriority Priority = EJesterWorkPriority::Normal, float DeadlineSeconds = -1.0f);
+
+	// Returns false when the work already ran or was cancelled
+	UFUNCTION(BlueprintCallable, Category = "Jester|Scheduler")
+	bool Cancel(FJesterWorkHandle Handle);
+
+	UFUNCTION(BlueprintCallable, Category = "Jester|Scheduler")
+	void SetLaneBudget(EJesterWorkPriority Priority, float BudgetMs);
+
+	UFUNCTION(BlueprintPure, Category = "Jester|Scheduler")
+	float GetLaneBudget(EJesterWorkPriority Priority) const;
+
+	UFUNCTION(BlueprintPure, Category = "Jester|Scheduler")
+	int32 GetNumPendingWork() const;
+
+	// Work that waited this many frames runs even when its lane is out of budget
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Jester|Scheduler")
+	int32 MaxWaitFrames = 30;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FWorkItem
+	{
+		TFunction<void()> Work;
+		// World time in seconds, MAX_dbl without deadline
+		double Deadline = MAX_dbl;
+		uint64 ScheduledFrame = 0;
+		int32 Id = 0;
+	};
+
+	struct FLane
+	{
+		// Heap ordered by deadline then by schedule order
+		TArray<FWorkItem> Items;
+		double BudgetSeconds = 0.0;
+	};
+
+	struct FWorkItemOrder
+	{
+		bool operator()(const FWorkItem& A, const FWorkItem& B) const
+		{
+			return A.Deadline != B.Deadline ? A.Deadline < B.Deadline : A.Id < B.Id;
+		}
+	};
+
+	// Runs the work that can't wait anymore, then whatever fits in the budget. Returns the time spent
+	double RunLane(FLane& Lane, double Now, uint64 Frame);
+	void RunItem(FWorkItem& Item);
+	void UpdatePendingStat();
+
+	FLane Lanes[static_cast<int32>(EJesterWorkPriority::MAX)];
+	int32 NextId = 1;
+};
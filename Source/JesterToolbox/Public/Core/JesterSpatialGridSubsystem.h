@@ -0,0 +1,107 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "JesterSpatialGridSubsystem.generated.h"
+
+USTRUCT(BlueprintType)
+struct FJesterSpatialQueryResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Jester|SpatialGrid")
+	TArray<AActor*> Actors;
+};
+
+/**
+ * Uniform hash grid of registered actors for proximity queries, instead of distance checks against every actor.
+ * Locations are refreshed once per frame (see bUpdateLocationsEveryFrame) or through UpdateLocation, moving an actor
+ * only touches the cells it leaves and enters. Actors are unregistered when they end play or get destroyed, entries
+ * of actors that went away some other way are skipped by the queries and dropped on the next refresh.
+ */
+UCLASS()
+class JESTERTOOLBOX_API UJesterSpatialGridSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "Jester|SpatialGrid")
+	void Register(AActor* Actor);
+
+	UFUNCTION(BlueprintCallable, Category = "Jester|SpatialGrid")
+	void Unregister(AActor* Actor);
+
+	UFUNCTION(BlueprintCallable, Category = "Jester|SpatialGrid")
+	void UpdateLocation(AActor* Actor);
+
+	UFUNCTION(BlueprintCallable, Category = "Jester|SpatialGrid")
+	void UpdateAllLocations();
+
+	// Actors within Radius of Center, in no particular order
+	UFUNCTION(BlueprintCallable, Category = "Jester|SpatialGrid")
+	void QueryRadius(FVector Center, float Radius, TArray<AActor*>& OutActors, TSubclassOf<AActor> ActorClass = nullptr) const;
+
+	// At most Count actors within MaxRadius of Center, nearest first
+	UFUNCTION(BlueprintCallable, Category = "Jester|SpatialGrid")
+	void QueryNearest(FVector Center, int32 Count, float MaxRadius, TArray<AActor*>& OutActors, TSubclassOf<AActor> ActorClass = nullptr) const;
+
+	// One QueryRadius per center, run in parallel
+	UFUNCTION(BlueprintCallable, Category = "Jester|SpatialGrid")
+	void QueryRadiusBatch(const TArray<FVector>& Centers, float Radius, TArray<FJesterSpatialQueryResult>& OutResults, TSubclassOf<AActor> ActorClass = nullptr) const;
+
+	// Rebuilds the grid. Cells about the size of the usual query radius work best
+	UFUNCTION(BlueprintCallable, Category = "Jester|SpatialGrid")
+	void SetCellSize(float InCellSize);
+
+	UFUNCTION(BlueprintPure, Category = "Jester|SpatialGrid")
+	int32 GetNumRegistered() const { return Entries.Num(); }
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Jester|SpatialGrid")
+	bool bUpdateLocationsEveryFrame = true;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FEntry
+	{
+		// The grid doesn't keep actors alive, the key still finds the entry once the actor is gone
+		TWeakObjectPtr<AActor> Actor;
+		TObjectKey<AActor> Key;
+		FVector Location = FVector::ZeroVector;
+		FIntVector Cell = FIntVector::ZeroValue;
+		// Position of the entry in its cell
+		int32 IndexInCell = 0;
+	};
+
+	UFUNCTION()
+	void HandleActorDestroyed(AActor* Actor);
+
+	UFUNCTION()
+	void HandleActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+
+	void RemoveEntry(int32 EntryIndex);
+
+	FIntVector GetCell(const FVector& Location) const;
+	void AddToCell(int32 EntryIndex);
+	void RemoveFromCell(int32 EntryIndex);
+	void SetLocation(int32 EntryIndex, const FVector& Location);
+
+	template<typename TVisitor>
+	void ForEachInRadius(const FVector& Center, float Radius, const UClass* ActorClass, TVisitor Visitor) const;
+
+	float CellSize = 1000.0f;
+
+	// Dense so the per frame refresh walks contiguous memory
+	TArray<FEntry> Entries;
+	TMap<TObjectKey<AActor>, int32> ActorToEntry;
+	TMap<FIntVector, TArray<int32>> Cells;
+};
@@ -0,0 +1,71 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "JesterSpawnTemplateSubsystem.generated.h"
+
+USTRUCT()
+struct FJesterSpawnArchetype
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	AActor* Actor = nullptr;
+
+	// The archetype is hidden and without collision, clones get the values its construction left
+	bool bHidden = false;
+	bool bEnableCollision = true;
+};
+
+/**
+ * Spawns actors by cloning a constructed archetype instead of running their construction scripts.
+ * The first spawn of a class builds a hidden archetype (construction scripts and components included), later spawns
+ * duplicate it into the level and go through the same initialization as actors loaded with a map.
+ * Only for classes whose construction doesn't depend on the spawn transform or on per instance state, check them with
+ * ValidateTemplateClone (or Jester.Spawn.ValidateTemplates 1) before switching them over.
+ * Like actors loaded with a map, clones don't fire UWorld's OnActorSpawned (it can only be broadcast by the engine),
+ * listeners that need them should hook BeginPlay or OnTemplateActorSpawned instead.
+ */
+UCLASS()
+class JESTERTOOLBOX_API UJesterSpawnTemplateSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnTemplateActorSpawned, AActor* /* Actor */);
+	// Fired once a clone is initialized (and has begun play if the world has), in place of UWorld's OnActorSpawned
+	FOnTemplateActorSpawned OnTemplateActorSpawned;
+
+	UFUNCTION(BlueprintCallable, Category = "Jester|Spawn", meta=(DeterminesOutputType = "ActorClass"))
+	AActor* SpawnFromTemplate(TSubclassOf<AActor> ActorClass, const FTransform& Transform, ULevel* Level = nullptr);
+
+	// Builds the archetype ahead of the first spawn
+	UFUNCTION(BlueprintCallable, Category = "Jester|Spawn")
+	void PrewarmTemplate(TSubclassOf<AActor> ActorClass);
+
+	// Drops the archetype, the next spawn rebuilds it. Call after changing anything the construction script reads
+	UFUNCTION(BlueprintCallable, Category = "Jester|Spawn")
+	void ResetTemplate(TSubclassOf<AActor> ActorClass);
+
+	// Spawns one actor normally and one from the template, logs every property or component registration that differs
+	// (and any component the template left registered) and destroys both. Returns the number of differences
+	UFUNCTION(BlueprintCallable, Category = "Jester|Spawn")
+	int32 ValidateTemplateClone(TSubclassOf<AActor> ActorClass);
+
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	const FJesterSpawnArchetype* GetOrCreateArchetype(UClass* ActorClass);
+	AActor* CloneArchetype(const FJesterSpawnArchetype& Archetype, const FTransform& Transform, ULevel* Level);
+
+	UPROPERTY()
+	TMap<UClass*, FJesterSpawnArchetype> Archetypes;
+
+	// Classes already checked by Jester.Spawn.ValidateTemplates
+	TSet<const UClass*> ValidatedClasses;
+};
@@ -0,0 +1,95 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "GameplayTagContainer.h"
+#include "JesterStateTrackerComponent.generated.h"
+
+struct FNetDeltaSerializeInfo;
+
+/**
+ * One bit per state of a UJesterStateTrackerComponent. Replicates as a delta: a connection only receives the bits that
+ * changed since the last state it got.
+ */
+USTRUCT()
+struct JESTERTOOLBOX_API FJesterStateBitset
+{
+	GENERATED_BODY()
+
+	static constexpr int32 MaxStates = 1024;
+
+	bool IsSet(int32 Index) const
+	{
+		return Words.IsValidIndex(Index / 32) && (Words[Index / 32] & (1u << (Index % 32))) != 0;
+	}
+
+	void Set(int32 Index, bool bValue);
+	void Reset() { Words.Reset(); }
+
+	const TArray<uint32>& GetWords() const { return Words; }
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms);
+
+private:
+	TArray<uint32> Words;
+};
+
+template<>
+struct TStructOpsTypeTraits<FJesterStateBitset> : public TStructOpsTypeTraitsBase2<FJesterStateBitset>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
+/**
+ * Native side of the state tracker: replicates the current states as a bitset over the sorted state tags and calls
+ * OnReplicatedStateChanged on clients for every state that got added or removed.
+ * The state index is built from GetTrackedStates the first time it's needed, so states can be set before BeginPlay.
+ */
+UCLASS(Abstract, Blueprintable)
+class JESTERTOOLBOX_API UJesterStateTrackerComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UJesterStateTrackerComponent();
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	// Every state the tracker knows, sorted so the server and clients agree on the bit of each state
+	UFUNCTION(BlueprintCallable, Category = "Jester|StateTracker")
+	void InitializeStateIndex(const TArray<FGameplayTag>& States);
+
+	// Replicated from the server. On clients the change is predicted: the server sending the same value later doesn't
+	// call OnReplicatedStateChanged for it
+	UFUNCTION(BlueprintCallable, Category = "Jester|StateTracker")
+	void SetStateReplicated(FGameplayTag StateTag, bool bActive);
+
+protected:
+	// States used to build the index when InitializeStateIndex wasn't called, must be the same on server and clients
+	UFUNCTION(BlueprintNativeEvent, Category = "Jester|StateTracker")
+	TArray<FGameplayTag> GetTrackedStates() const;
+
+	UFUNCTION(BlueprintNativeEvent, Category = "Jester|StateTracker")
+	void OnReplicatedStateChanged(FGameplayTag StateTag, bool bAdded);
+
+private:
+	UFUNCTION()
+	void OnRep_ReplicatedStates();
+
+	void EnsureStateIndex();
+
+	UPROPERTY(ReplicatedUsing = OnRep_ReplicatedStates)
+	FJesterStateBitset ReplicatedStates;
+
+	// What the client applied so far, diffed against each update
+	FJesterStateBitset AppliedStates;
+
+	TArray<FGameplayTag> StateIndex;
+	TMap<FGameplayTag, int32> StateToBit;
+	bool bStateIndexInitialized = false;
+};
@@ -0,0 +1,28 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "JesterStatsLibrary.generated.h"
+
+/**
+ * Lets the script layer feed the JesterToolbox stat group (capabilities, aggregators)
+ */
+UCLASS()
+class JESTERTOOLBOX_API UJesterStatsLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	// Number of capability instances alive, call with a negative delta when they are released
+	UFUNCTION(ScriptCallable, Category="Stats")
+	static void ModifyCapabilityCount(int Delta);
+
+	// Called once per capability tree update with the number of capabilities that ended up active
+	UFUNCTION(ScriptCallable, Category="Stats")
+	static void AddCapabilityUpdate(int ActiveCapabilities);
+
+	UFUNCTION(ScriptCallable, Category="Stats")
+	static void AddAggregatorUpdate();
+};
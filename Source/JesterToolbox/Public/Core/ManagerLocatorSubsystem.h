@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
 
 #include "ManagerLocatorSubsystem.generated.h"
 
@@ -15,6 +16,10 @@ class JESTERTOOLBOX_API UManagerLocatorSubsystem : public UEngineSubsystem
 	GENERATED_BODY()
 	
 public:
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnManagerRegistered, UObject* /* Manager */);
+	// Lets code wait for a manager instead of polling GetManager
+	FOnManagerRegistered OnManagerRegistered;
+
 	UFUNCTION(BlueprintCallable, Category = "Jester|ManagerLocator")
 	void RegisterActorManager(AActor* Manager);
 
@@ -30,13 +35,92 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Jester|ManagerLocator", meta=(DeterminesOutputType = "ManagerClass"))
 	UObject* GetManager(TSubclassOf<UObject> ManagerClass);
 
+	// Same as GetManager, without the error when the manager isn't registered
+	UObject* FindManager(TSubclassOf<UObject> ManagerClass) const;
+
+	// First registered manager implementing Interface, native or script interface
+	UFUNCTION(BlueprintPure, Category = "Jester|ManagerLocator")
+	UObject* GetManagerByInterface(UClass* Interface);
+
+	// Same as GetManagerByInterface, without the error when no manager implements the interface
+	UObject* FindManagerByInterface(const UClass* Interface) const;
+
+	/**
+	 * Keyed managers: any number of managers of the same class, one per key (per team, per zone...).
+	 * Manager is an actor or an actor component, it's unregistered when it (or its owner) is destroyed.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Jester|ManagerLocator")
+	void RegisterManagerWithTag(UObject* Manager, FGameplayTag Key);
+
+	UFUNCTION(BlueprintCallable, Category = "Jester|ManagerLocator")
+	void RegisterManagerWithIndex(UObject* Manager, int32 Key);
+
+	// Removes every key of Manager
+	UFUNCTION(BlueprintCallable, Category = "Jester|ManagerLocator")
+	void UnregisterKeyedManager(UObject* Manager);
+
+	UFUNCTION(BlueprintPure, Category = "Jester|ManagerLocator", meta=(DeterminesOutputType = "ManagerClass"))
+	UObject* GetManagerByTag(TSubclassOf<UObject> ManagerClass, FGameplayTag Key) const;
+
+	UFUNCTION(BlueprintPure, Category = "Jester|ManagerLocator", meta=(DeterminesOutputType = "ManagerClass"))
+	UObject* GetManagerByIndex(TSubclassOf<UObject> ManagerClass, int32 Key) const;
+
+	// Every registered manager of ManagerClass or a child class, keyed or not, in registration order. Valid until the
+	// next registration
+	TConstArrayView<UObject*> GetAllManagersOfClass(TSubclassOf<UObject> ManagerClass) const;
+
+	UFUNCTION(BlueprintPure, Category = "Jester|ManagerLocator", meta=(DisplayName = "Get All Managers Of Class", ScriptName = "GetAllManagersOfClass", DeterminesOutputType = "ManagerClass"))
+	TArray<UObject*> CopyAllManagersOfClass(TSubclassOf<UObject> ManagerClass) const;
+
 private:
 	UFUNCTION()
 	void HandleComponentManagerOwnerDestroyed(AActor* Owner);
+
+	UFUNCTION()
+	void HandleKeyedManagerDestroyed(AActor* DestroyedActor);
+
+	void AddToInterfaceIndex(UObject* Manager);
+	void RemoveFromInterfaceIndex(UObject* Manager);
+	void AddToClassIndex(UObject* Manager);
+	void RemoveFromClassIndex(UObject* Manager);
+
+	struct FManagerKey
+	{
+		const UClass* Class = nullptr;
+		FName Tag;
+		int32 Index = INDEX_NONE;
+
+		friend bool operator==(const FManagerKey& A, const FManagerKey& B)
+		{
+			return A.Class == B.Class && A.Tag == B.Tag && A.Index == B.Index;
+		}
+
+		friend uint32 GetTypeHash(const FManagerKey& Key)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Key.Class), GetTypeHash(Key.Tag)), GetTypeHash(Key.Index));
+		}
+	};
+
+	void RegisterKeyedManager(UObject* Manager, FName Tag, int32 Index);
+	UObject* FindKeyedManager(const UClass* ManagerClass, FName Tag, int32 Index) const;
 	
 	UPROPERTY()
 	TArray<AActor*> ActorManagers;
 
 	UPROPERTY()
 	TArray<UActorComponent*> ComponentManagers;
+
+	// Interface -> managers implementing it, in registration order. Filled at registration so lookups don't walk the
+	// interfaces of every manager. The managers are kept alive by the arrays above
+	TMap<const UClass*, TArray<UObject*, TInlineAllocator<1>>> InterfaceImplementers;
+
+	// Keeps the keyed managers alive, they aren't in the arrays above
+	UPROPERTY()
+	TArray<UObject*> KeyedManagerObjects;
+
+	// (class, key) -> manager, for the manager class and each of its parents
+	TMap<FManagerKey, UObject*> KeyedManagers;
+
+	// Class -> managers of that class or a child class, keyed or not
+	TMap<const UClass*, TArray<UObject*>> ManagersByClass;
 };
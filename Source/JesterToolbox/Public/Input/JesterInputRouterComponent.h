@@ -0,0 +1,128 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "GameplayTagContainer.h"
+#include "JesterInputRouterComponent.generated.h"
+
+class UEnhancedInputComponent;
+class UInputAction;
+struct FInputActionInstance;
+
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EJesterActionEvent : uint8
+{
+	None = 0 UMETA(Hidden),
+	Started = 1 << 0,
+	Triggered = 1 << 1,
+	Completed = 1 << 2,
+	Canceled = 1 << 3
+};
+ENUM_CLASS_FLAGS(EJesterActionEvent);
+
+/** Runtime state of a registered input action, updated natively by UJesterInputRouterComponent */
+USTRUCT(BlueprintType)
+struct FJesterActionState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly)
+	FGameplayTag ActionTag;
+
+	UPROPERTY(BlueprintReadOnly)
+	const UInputAction* Action = nullptr;
+
+	// Last time the action was triggered (continuous event)
+	UPROPERTY(BlueprintReadOnly)
+	float LastTimeTriggered = -1.0f;
+
+	// Last time the action was completed (released)
+	UPROPERTY(BlueprintReadOnly)
+	float LastTimeCompleted = -1.0f;
+
+	// Last time the action was activated (started)
+	UPROPERTY(BlueprintReadOnly)
+	float LastActivationStartTime = -1.0f;
+
+	UPROPERTY(BlueprintReadOnly)
+	bool bIsActive = false;
+
+	// Events broadcast through OnActionEvent, the rest only update this state
+	UPROPERTY(BlueprintReadOnly, meta = (Bitmask, BitmaskEnum = "/Script/JesterToolbox.EJesterActionEvent"))
+	int32 NotifiedEvents = 0;
+};
+
+/**
+ * Receives Enhanced Input events natively and keeps the state of every registered action in a dense array.
+ * Scripts query the state by tag (or by index to skip the lookup) and only get called for the events they asked for
+ * with SetNotifiedEvents.
+ */
+UCLASS(Blueprintable)
+class JESTERTOOLBOX_API UJesterInputRouterComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FJesterActionEventSignature, FGameplayTag, ActionTag, EJesterActionEvent, Event);
+	UPROPERTY(BlueprintAssignable)
+	FJesterActionEventSignature OnActionEvent;
+
+	// Each action can only be registered once. Bound right away if the router is already initialized
+	UFUNCTION(BlueprintCallable, Category = "Jester|Input")
+	void RegisterInputAction(FGameplayTag ActionTag, const UInputAction* Action);
+
+	// Binds the registered actions, and the ones registered later, to InInputComponent
+	UFUNCTION(BlueprintCallable, Category = "Jester|Input")
+	void InitializeRouter(UEnhancedInputComponent* InInputComponent);
+
+	UFUNCTION(BlueprintPure, Category = "Jester|Input")
+	bool IsRouterInitialized() const { return InputComponent != nullptr; }
+
+	// EventMask is a combination of EJesterActionEvent
+	UFUNCTION(BlueprintCallable, Category = "Jester|Input")
+	void SetNotifiedEvents(FGameplayTag ActionTag, UPARAM(meta = (Bitmask, BitmaskEnum = "/Script/JesterToolbox.EJesterActionEvent")) int32 EventMask);
+
+	UFUNCTION(BlueprintPure, Category = "Jester|Input")
+	bool IsActionActive(FGameplayTag ActionTag) const;
+
+	// Whether the action was triggered, activated or completed at most MaxTimeAgo seconds ago
+	UFUNCTION(BlueprintPure, Category = "Jester|Input")
+	bool WasActionTriggered(FGameplayTag ActionTag, float MaxTimeAgo) const;
+
+	UFUNCTION(BlueprintPure, Category = "Jester|Input")
+	bool WasActionActivated(FGameplayTag ActionTag, float MaxTimeAgo) const;
+
+	UFUNCTION(BlueprintPure, Category = "Jester|Input")
+	bool WasActionCompleted(FGameplayTag ActionTag, float MaxTimeAgo) const;
+
+	// Index into the dense state, stable for the lifetime of the component. INDEX_NONE if the tag isn't registered
+	UFUNCTION(BlueprintPure, Category = "Jester|Input")
+	int32 GetActionIndex(FGameplayTag ActionTag) const;
+
+	UFUNCTION(BlueprintPure, Category = "Jester|Input")
+	int32 GetNumActions() const { return ActionStates.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "Jester|Input")
+	FJesterActionState GetActionState(int32 ActionIndex) const;
+
+	const FJesterActionState* FindActionState(FGameplayTag ActionTag) const;
+
+private:
+	void BindAction(int32 ActionIndex);
+	void HandleStarted(const FInputActionInstance& Instance, int32 ActionIndex);
+	void HandleTriggered(const FInputActionInstance& Instance, int32 ActionIndex);
+	void HandleCompleted(const FInputActionInstance& Instance, int32 ActionIndex);
+	void HandleCanceled(const FInputActionInstance& Instance, int32 ActionIndex);
+	void Notify(const FJesterActionState& State, EJesterActionEvent Event);
+	bool WasRecent(float EventTime, float MaxTimeAgo) const;
+
+	UPROPERTY()
+	UEnhancedInputComponent* InputComponent = nullptr;
+
+	UPROPERTY()
+	TArray<FJesterActionState> ActionStates;
+
+	TMap<FGameplayTag, int32> TagToIndex;
+};
@@ -0,0 +1,36 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+
+/**
+ * Low level memory tracker tags, visible with 'stat LLMFULL' and in Insights when running with -LLM.
+ * The underscores make the subsystem tags children of JesterToolbox.
+ */
+LLM_DECLARE_TAG_API(JesterToolbox, JESTERTOOLBOX_API);
+LLM_DECLARE_TAG_API(JesterToolbox_Managers, JESTERTOOLBOX_API);
+LLM_DECLARE_TAG_API(JesterToolbox_Assets, JESTERTOOLBOX_API);
+LLM_DECLARE_TAG_API(JesterToolbox_Curves, JESTERTOOLBOX_API);
+LLM_DECLARE_TAG_API(JesterToolbox_Capabilities, JESTERTOOLBOX_API);
+
+namespace JesterMemory
+{
+	// Prints the memory and instance count of the toolbox objects alive, grouped by subsystem
+	void Report(FOutputDevice& Ar);
+
+	// Marks toolbox work on the calling thread, whether or not LLM is running. The benchmarks use it to charge only
+	// the allocations made by toolbox code
+	JESTERTOOLBOX_API void EnterToolboxScope();
+	JESTERTOOLBOX_API void LeaveToolboxScope();
+	JESTERTOOLBOX_API bool IsInToolboxScope();
+
+	struct FToolboxScope
+	{
+		FToolboxScope() { EnterToolboxScope(); }
+		~FToolboxScope() { LeaveToolboxScope(); }
+	};
+}
+
+#define JESTER_LLM_SCOPE(Subsystem) LLM_SCOPE_BYTAG(JesterToolbox_##Subsystem); const JesterMemory::FToolboxScope ANONYMOUS_VARIABLE(JesterToolboxScope)
@@ -0,0 +1,97 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("JesterToolbox"), STATGROUP_JesterToolbox, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SpawnActor"), STAT_JesterSpawn, STATGROUP_JesterToolbox, JESTERTOOLBOX_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CopyObject"), STAT_JesterCopyObject, STATGROUP_JesterToolbox, JESTERTOOLBOX_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Manager Lookups"), STAT_JesterManagerLookups, STATGROUP_JesterToolbox, JESTERTOOLBOX_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Manager Lookup Misses"), STAT_JesterManagerLookupMisses, STATGROUP_JesterToolbox, JESTERTOOLBOX_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Asset Lookups"), STAT_JesterAssetLookups, STATGROUP_JesterToolbox, JESTERTOOLBOX_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Asset Streaming Requests"), STAT_JesterAssetStreamingRequests, STATGROUP_JesterToolbox, JESTERTOOLBOX_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Spawn Calls"), STAT_JesterSpawnCalls, STATGROUP_JesterToolbox, JESTERTOOLBOX_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("CopyObject Calls"), STAT_JesterCopyObjectCalls, STATGROUP_JesterToolbox, JESTERTOOLBOX_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Capability Tree Updates"), STAT_JesterCapabilityUpdates, STATGROUP_JesterToolbox, JESTERTOOLBOX_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Active Capabilities"), STAT_JesterActiveCapabilities, STATGROUP_JesterToolbox, JESTERTOOLBOX_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Aggregator Updates"), STAT_JesterAggregatorUpdates, STATGROUP_JesterToolbox, JESTERTOOLBOX_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Scheduled Work Run"), STAT_JesterScheduledWorkRun, STATGROUP_JesterToolbox, JESTERTOOLBOX_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Scheduler Budget Overruns"), STAT_JesterSchedulerBudgetOverruns, STATGROUP_JesterToolbox, JESTERTOOLBOX_API);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending Initialization Events"), STAT_JesterPendingInitializationEvents, STATGROUP_JesterToolbox, JESTERTOOLBOX_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Capabilities"), STAT_JesterCapabilities, STATGROUP_JesterToolbox, JESTERTOOLBOX_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending Scheduled Work"), STAT_JesterPendingScheduledWork, STATGROUP_JesterToolbox, JESTERTOOLBOX_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Locator Resident Memory"), STAT_JesterLocatorResidentBytes, STATGROUP_JesterToolbox, JESTERTOOLBOX_API);
+
+/**
+ * Mirror of the stats above that doesn't depend on the stats system, so the values can be dumped with
+ * Jester.Stats.Dump on headless servers and in builds where STATS is compiled out.
+ */
+namespace JesterStats
+{
+	enum class ECounter : uint8
+	{
+		// Reset every frame
+		ManagerLookups,
+		ManagerLookupMisses,
+		AssetLookups,
+		AssetStreamingRequests,
+		SpawnCalls,
+		SpawnCycles,
+		CopyObjectCalls,
+		CopyObjectCycles,
+		CapabilityUpdates,
+		ActiveCapabilities,
+		AggregatorUpdates,
+		ScheduledWorkRun,
+		SchedulerBudgetOverruns,
+
+		// Current values
+		PendingInitializationEvents,
+		Capabilities,
+		PendingScheduledWork,
+		LocatorResidentBytes,
+
+		Num
+	};
+
+	JESTERTOOLBOX_API void Add(ECounter Counter, int64 Delta = 1);
+	JESTERTOOLBOX_API void Set(ECounter Counter, int64 Value);
+
+	// Moves the per frame counters to their last frame value, called at the end of every frame
+	void EndFrame();
+	void Dump(FOutputDevice& Ar);
+
+	// Times a scope for both the stat system cycle counter and the JesterStats counter
+	struct FScopedCycles
+	{
+		FScopedCycles(ECounter InCounter, TStatId StatId)
+			: Counter(InCounter), StartCycles(FPlatformTime::Cycles64())
+#if STATS
+			, CycleCounter(StatId)
+#endif
+		{
+		}
+
+		~FScopedCycles()
+		{
+			Add(Counter, FPlatformTime::Cycles64() - StartCycles);
+		}
+
+	private:
+		ECounter Counter;
+		uint64 StartCycles;
+#if STATS
+		FScopeCycleCounter CycleCounter;
+#endif
+	};
+}
+
+#define JESTER_STAT_ADD(Counter, Amount) do { INC_DWORD_STAT_BY(STAT_Jester##Counter, Amount); JesterStats::Add(JesterStats::ECounter::Counter, Amount); } while (0)
+#define JESTER_STAT_INC(Counter) JESTER_STAT_ADD(Counter, 1)
+#define JESTER_STAT_SET(Counter, Value) do { SET_DWORD_STAT(STAT_Jester##Counter, Value); JesterStats::Set(JesterStats::ECounter::Counter, Value); } while (0)
+#define JESTER_SCOPE_CYCLE_COUNTER(Counter) JesterStats::FScopedCycles ANONYMOUS_VARIABLE(JesterCycles)(JesterStats::ECounter::Counter##Cycles, GET_STATID(STAT_Jester##Counter))
@@ -0,0 +1,31 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+/**
+ * Unreal Insights instrumentation for the toolbox, enable with -trace=cpu,counters,bookmark,jestertoolbox
+ * Every macro below checks the JesterToolbox channel first, so they only cost a branch when the channel is off.
+ */
+#if CPUPROFILERTRACE_ENABLED
+
+UE_TRACE_CHANNEL_EXTERN(JesterToolboxChannel, JESTERTOOLBOX_API);
+
+#define JESTER_TRACE_ENABLED() UE_TRACE_CHANNELEXPR_IS_ENABLED(JesterToolboxChannel)
+#define JESTER_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(Name, JesterToolboxChannel)
+
+#else
+
+#define JESTER_TRACE_ENABLED() false
+#define JESTER_TRACE_SCOPE(Name)
+
+#endif
+
+// Wrapped in do/while so they behave as a single statement, an else at the call site can't bind to their if
+#define JESTER_TRACE_COUNTER_INCREMENT(Counter) do { if (JESTER_TRACE_ENABLED()) { TRACE_COUNTER_INCREMENT(Counter); } } while (0)
+#define JESTER_TRACE_COUNTER_SET(Counter, Value) do { if (JESTER_TRACE_ENABLED()) { TRACE_COUNTER_SET(Counter, Value); } } while (0)
+#define JESTER_TRACE_BOOKMARK(Format, ...) do { if (JESTER_TRACE_ENABLED()) { TRACE_BOOKMARK(Format, ##__VA_ARGS__); } } while (0)
@@ -0,0 +1,56 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "JesterTextLibrary.generated.h"
+
+/**
+ * Builds debug text in a single reusable buffer instead of a new string per line. Begin clears it, the Append
+ * functions write into it and Get hands it to ImGui::Text, which copies it right away.
+ * The buffer keeps its allocation, so once it has grown to the longest line a frame needs, nothing allocates.
+ * Game thread only, the text is valid until the next Begin.
+ */
+UCLASS()
+class JESTERTOOLBOX_API UJesterTextLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(ScriptCallable, Category="Text")
+	static void Begin(const FString& Prefix);
+
+	UFUNCTION(ScriptCallable, Category="Text")
+	static const FString& Get();
+
+	UFUNCTION(ScriptCallable, Category="Text")
+	static void Append(const FString& Text);
+
+	UFUNCTION(ScriptCallable, Category="Text")
+	static void AppendInt(int Value);
+
+	UFUNCTION(ScriptCallable, Category="Text")
+	static void AppendFloat(float Value, int Decimals = 2);
+
+	UFUNCTION(ScriptCallable, Category="Text")
+	static void AppendBool(bool bValue);
+
+	// Same layout as FVector::ToString
+	UFUNCTION(ScriptCallable, Category="Text")
+	static void AppendVector(const FVector& Value);
+
+	UFUNCTION(ScriptCallable, Category="Text")
+	static void AppendName(FName Name);
+
+	UFUNCTION(ScriptCallable, Category="Text")
+	static void AppendTag(FGameplayTag Tag);
+
+	// Appends "None" for a null object
+	UFUNCTION(ScriptCallable, Category="Text")
+	static void AppendObjectName(const UObject* Object);
+
+private:
+	static FString& GetBuffer();
+};
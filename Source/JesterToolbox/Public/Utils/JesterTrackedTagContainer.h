@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "JesterTrackedTagContainer.generated.h"
+
+USTRUCT()
+struct FJesterTagChange
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FGameplayTag Tag;
+
+	UPROPERTY()
+	bool bAdded = false;
+
+	// Generation of the container right after the change
+	UPROPERTY()
+	int32 Generation = 0;
+};
+
+/**
+ * Tag container that logs its changes. Consumers remember the generation they last read and get the exact tags added
+ * and removed since, instead of diffing against a shadow copy every frame.
+ */
+USTRUCT(BlueprintType)
+struct JESTERTOOLBOX_API FJesterTrackedTagContainer
+{
+	GENERATED_BODY()
+
+	static constexpr int32 MaxLoggedChanges = 64;
+
+	const FGameplayTagContainer& GetTags() const { return Tags; }
+	int32 GetGeneration() const { return Generation; }
+	bool HasTag(const FGameplayTag& Tag) const { return Tags.HasTag(Tag); }
+	bool HasTagExact(const FGameplayTag& Tag) const { return Tags.HasTagExact(Tag); }
+
+	// Return false when the tag was already there or missing, nothing gets logged then
+	bool AddTag(const FGameplayTag& Tag);
+	bool RemoveTag(const FGameplayTag& Tag);
+	void AppendTags(const FGameplayTagContainer& Other);
+	void Reset();
+
+	/**
+	 * Net changes since InOutGeneration, a tag added then removed in between shows in neither list. InOutGeneration is
+	 * moved to the current generation. Both lists are emptied first, so they can be reused from one call to the next.
+	 * Returns false when the log doesn't go back that far anymore, read GetTags to start over.
+	 */
+	bool GetChangesSince(int32& InOutGeneration, TArray<FGameplayTag>& OutAddedTags, TArray<FGameplayTag>& OutRemovedTags) const;
+
+private:
+	void LogChange(const FGameplayTag& Tag, bool bAdded);
+
+	UPROPERTY(VisibleAnywhere)
+	FGameplayTagContainer Tags;
+
+	UPROPERTY()
+	TArray<FJesterTagChange> ChangeLog;
+
+	UPROPERTY()
+	int32 Generation = 0;
+
+	// Oldest generation GetChangesSince can answer for
+	UPROPERTY()
+	int32 OldestLoggedGeneration = 0;
+};
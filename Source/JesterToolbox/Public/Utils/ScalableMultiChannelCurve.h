@@ -0,0 +1,137 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Curves/RichCurve.h"
+#include "JesterToolboxMemory.h"
+#include "ScalableMultiChannelCurve.generated.h"
+
+struct FPropertyChangedEvent;
+
+USTRUCT(BlueprintType)
+struct FScalableMultiChannelCurveKey
+{
+	GENERATED_BODY()
+
+	// Normalized
+	UPROPERTY(EditAnywhere)
+	float Time = 0.0f;
+
+	UPROPERTY(EditAnywhere)
+	FVector4f Value = FVector4f(0.0f, 0.0f, 0.0f, 0.0f);
+
+	// How the segment that starts at this key is interpolated, like FRichCurveKey
+	UPROPERTY(EditAnywhere)
+	TEnumAsByte<ERichCurveInterpMode> InterpMode = RCIM_Linear;
+
+	// Auto computes the tangents of cubic keys, user and break use the ones below
+	UPROPERTY(EditAnywhere)
+	TEnumAsByte<ERichCurveTangentMode> TangentMode = RCTM_Auto;
+
+	// Per channel
+	UPROPERTY(EditAnywhere)
+	FVector4f ArriveTangent = FVector4f(0.0f, 0.0f, 0.0f, 0.0f);
+
+	UPROPERTY(EditAnywhere)
+	FVector4f LeaveTangent = FVector4f(0.0f, 0.0f, 0.0f, 0.0f);
+};
+
+/**
+ * Up to four curves sharing their key times, for positions, colors and scales. Keys have the constant, linear and
+ * cubic modes of FRichCurveKey (weighted tangents aren't supported) and hold the value of every channel, so a single
+ * key search feeds them all. Scaled in X like FScalableRuntimeCurve, and per channel in Y.
+ * Keys are edited and saved as an array of structs, evaluation reads the key times and channel arrays rebuilt from them.
+ */
+USTRUCT(BlueprintType)
+struct JESTERTOOLBOX_API FScalableMultiChannelCurve
+{
+	GENERATED_BODY()
+
+	static constexpr int32 MaxChannels = 4;
+
+protected:
+	// Sorted by time when rebuilt, keys edited by hand can be in any order
+	UPROPERTY(EditAnywhere)
+	TArray<FScalableMultiChannelCurveKey> Keys;
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float ScaleX = 1.0f;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FVector4f ChannelScales = FVector4f(1.0f, 1.0f, 1.0f, 1.0f);
+
+	bool HasCurve() const
+	{
+		return KeyTimes.Num() > 0;
+	}
+
+	int32 GetNumKeys() const
+	{
+		return KeyTimes.Num();
+	}
+
+	void AddKeyOrSetNormalized(float Time, const FVector4f& Value, ERichCurveInterpMode InterpMode = RCIM_Linear);
+
+	FVector4f Evaluate(float InTime) const
+	{
+		return EvaluateSegment(InTime / ScaleX, FindSegment(InTime / ScaleX));
+	}
+
+	FVector EvaluateVector(float InTime) const
+	{
+		const FVector4f Value = Evaluate(InTime);
+		return FVector(Value.X, Value.Y, Value.Z);
+	}
+
+	FLinearColor EvaluateColor(float InTime) const
+	{
+		const FVector4f Value = Evaluate(InTime);
+		return FLinearColor(Value.X, Value.Y, Value.Z, Value.W);
+	}
+
+	// Times in increasing order walk the keys once instead of searching for each of them
+	void EvaluateBatch(TConstArrayView<float> InTimes, TArrayView<FVector4f> OutValues) const;
+
+	// Scaled times of the first and last keys. Not FScalableRuntimeCurve::GetTimeRange, which gives the end time and value
+	void GetTimeBounds(float& OutTimeStart, float& OutTimeEnd) const
+	{
+		OutTimeStart = KeyTimes.Num() > 0 ? KeyTimes[0] * ScaleX : 0.0f;
+		OutTimeEnd = KeyTimes.Num() > 0 ? KeyTimes.Last() * ScaleX : 0.0f;
+	}
+
+	// Sorts the keys, computes the auto tangents and rebuilds what evaluation reads. Done on load, when a key is added
+	// and, in the editor, when a property of the owning object changes
+	void RebuildChannels();
+
+	void PostSerialize(const FArchive& Ar);
+
+#if WITH_EDITOR
+	// Rebuilds every multi-channel curve of Object, registered by the module for edits in the details panel
+	static void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+#endif
+
+private:
+	// Index of the last key at or before NormalizedTime, INDEX_NONE before the first key
+	int32 FindSegment(float NormalizedTime) const;
+	FVector4f EvaluateSegment(float NormalizedTime, int32 Segment) const;
+
+	struct FChannel
+	{
+		TArray<float> Values;
+		TArray<float> ArriveTangents;
+		TArray<float> LeaveTangents;
+	};
+
+	// Rebuilt from Keys, one array per channel so a segment search feeds every channel from contiguous memory
+	TArray<float> KeyTimes;
+	TArray<TEnumAsByte<ERichCurveInterpMode>> InterpModes;
+	FChannel Channels[MaxChannels];
+};
+
+template<>
+struct TStructOpsTypeTraits<FScalableMultiChannelCurve> : public TStructOpsTypeTraitsBase2<FScalableMultiChannelCurve>
+{
+	enum
+	{
+		WithPostSerialize = true,
+	};
+};
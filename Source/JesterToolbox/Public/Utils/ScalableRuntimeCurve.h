@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "CoreMinimal.h"
+#include "JesterToolboxMemory.h"
 #include "UObject/Object.h"
 #include "ScalableRuntimeCurve.generated.h"
 
@@ -35,11 +36,13 @@ public:
 
 	void AddDefaultNormalizedKey(float Time, float Value)
 	{
+		JESTER_LLM_SCOPE(Curves);
 		Curve.EditorCurveData.UpdateOrAddKey(Time, Value);
 	}
 
 	void AddKeyOrSetNormalized(float Time, float Value)
 	{
+		JESTER_LLM_SCOPE(Curves);
 		Curve.GetRichCurve()->UpdateOrAddKey(Time, Value);
 	}
 
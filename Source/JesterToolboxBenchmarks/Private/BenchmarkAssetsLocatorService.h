@@ -0,0 +1,30 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/AssetsLocatorService.h"
+#include "BenchmarkAssetsLocatorService.generated.h"
+
+/**
+ * Locator filled from code so the benchmarks don't depend on the project's locator blueprint
+ */
+UCLASS(Transient, NotBlueprintable)
+class UBenchmarkAssetsLocatorService : public UAssetsLocatorService
+{
+	GENERATED_BODY()
+
+public:
+	// Spreads the tags over NumCategories categories, every tag maps to one asset and one class
+	void Populate(const TArray<FGameplayTag>& Tags, const TArray<UObject*>& InAssets, int32 NumCategories)
+	{
+		RegisteredAssets.Empty();
+		for (int32 i = 0; i < Tags.Num(); ++i)
+		{
+			FAssetCategory& Category = RegisteredAssets.FindOrAdd(FString::Printf(TEXT("Category_%d"), i % NumCategories));
+			Category.Assets.Add(Tags[i], InAssets[i % InAssets.Num()]);
+			Category.Classes.Add(Tags[i], InAssets[i % InAssets.Num()]->GetClass());
+		}
+		bInitialized = false;
+	}
+};
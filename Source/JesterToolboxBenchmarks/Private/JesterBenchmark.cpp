@@ -0,0 +1,72 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "JesterBenchmark.h"
+
+#include "Dom/JsonObject.h"
+
+double FJesterBenchmarkResult::GetPercentile(double Percentile) const
+{
+	if (SecondsPerCall.IsEmpty())
+	{
+		return 0.0;
+	}
+
+	TArray<double> Sorted = SecondsPerCall;
+	Sorted.Sort();
+	const int32 Rank = FMath::CeilToInt32(Percentile / 100.0 * Sorted.Num());
+	return Sorted[FMath::Clamp(Rank - 1, 0, Sorted.Num() - 1)];
+}
+
+double FJesterBenchmarkResult::GetMean() const
+{
+	if (SecondsPerCall.IsEmpty())
+	{
+		return 0.0;
+	}
+
+	double Total = 0.0;
+	for (const double Sample : SecondsPerCall)
+	{
+		Total += Sample;
+	}
+	return Total / SecondsPerCall.Num();
+}
+
+TSharedRef<FJsonObject> FJesterBenchmarkResult::ToJson() const
+{
+	// Everything is reported in nanoseconds per call, it reads better than seconds for micro benchmarks
+	constexpr double ToNs = 1e9;
+
+	TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+	Json->SetStringField(TEXT("Name"), Name);
+	Json->SetNumberField(TEXT("CallsPerSample"), CallsPerSample);
+	Json->SetNumberField(TEXT("Samples"), SecondsPerCall.Num());
+	Json->SetNumberField(TEXT("MinNs"), GetPercentile(0.0) * ToNs);
+	Json->SetNumberField(TEXT("MeanNs"), GetMean() * ToNs);
+	Json->SetNumberField(TEXT("P50Ns"), GetPercentile(50.0) * ToNs);
+	Json->SetNumberField(TEXT("P90Ns"), GetPercentile(90.0) * ToNs);
+	Json->SetNumberField(TEXT("P99Ns"), GetPercentile(99.0) * ToNs);
+	Json->SetNumberField(TEXT("MaxNs"), GetPercentile(100.0) * ToNs);
+	if (AllocationsPerCall != INDEX_NONE)
+	{
+		Json->SetNumberField(TEXT("AllocationsPerCall"), AllocationsPerCall);
+	}
+	if (AllocationBudget != INDEX_NONE)
+	{
+		Json->SetNumberField(TEXT("AllocationBudget"), AllocationBudget);
+	}
+	if (AllocationsPerCall != INDEX_NONE)
+	{
+		Json->SetBoolField(TEXT("ToolboxAllocationsOnly"), bToolboxAllocationsOnly);
+	}
+	return Json;
+}
+
+UWorld* UJesterScriptBenchmark::GetWorld() const
+{
+	if (HasAnyFlags(RF_ClassDefaultObject))
+	{
+		return nullptr;
+	}
+	return GetTypedOuter<UWorld>();
+}
@@ -0,0 +1,337 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "JesterBenchmarkCommandlet.h"
+
+#include "JesterBenchmark.h"
+#include "JesterToolboxBenchmarks.h"
+#include "JesterToolboxMemory.h"
+#include "NativeBenchmarks.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Misc/App.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectIterator.h"
+
+namespace
+{
+	// Wraps a script benchmark so the commandlet can run it like a native one
+	class FScriptBenchmarkAdapter : public FJesterBenchmark
+	{
+	public:
+		FScriptBenchmarkAdapter(UClass* InBenchmarkClass)
+			: FJesterBenchmark(InBenchmarkClass->GetDefaultObject<UJesterScriptBenchmark>()->BenchmarkName.IsEmpty()
+				? InBenchmarkClass->GetName()
+				: InBenchmarkClass->GetDefaultObject<UJesterScriptBenchmark>()->BenchmarkName,
+				InBenchmarkClass->GetDefaultObject<UJesterScriptBenchmark>()->CallsPerSample,
+				InBenchmarkClass->GetDefaultObject<UJesterScriptBenchmark>()->AllocationBudget,
+				InBenchmarkClass->GetDefaultObject<UJesterScriptBenchmark>()->bToolboxAllocationsOnly)
+			, BenchmarkClass(InBenchmarkClass)
+		{
+		}
+
+		virtual bool Setup(UWorld* InWorld) override
+		{
+			World = InWorld;
+			Benchmark.Reset(NewObject<UJesterScriptBenchmark>(World, BenchmarkClass));
+			Benchmark->Setup();
+			return true;
+		}
+
+		virtual void RunSample() override
+		{
+			if (Benchmark->bTickWorld)
+			{
+				World->Tick(LEVELTICK_All, 1.0f / 60.0f);
+			}
+			else
+			{
+				Benchmark->RunSample();
+			}
+		}
+
+		virtual void Teardown() override
+		{
+			Benchmark->Teardown();
+			Benchmark.Reset();
+		}
+
+	private:
+		UClass* BenchmarkClass = nullptr;
+		UWorld* World = nullptr;
+		TStrongObjectPtr<UJesterScriptBenchmark> Benchmark;
+	};
+
+	void GatherScriptBenchmarks(TArray<TUniquePtr<FJesterBenchmark>>& OutBenchmarks)
+	{
+		for (TObjectIterator<UClass> It; It; ++It)
+		{
+			UClass* Class = *It;
+			if (Class->IsChildOf(UJesterScriptBenchmark::StaticClass())
+				&& !Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists))
+			{
+				OutBenchmarks.Add(MakeUnique<FScriptBenchmarkAdapter>(Class));
+			}
+		}
+	}
+
+	UWorld* CreateBenchmarkWorld()
+	{
+		UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("JesterBenchmarkWorld"));
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+		return World;
+	}
+
+	void DestroyBenchmarkWorld(UWorld* World)
+	{
+		World->EndPlay(EEndPlayReason::Quit);
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	// Forwards everything to the real allocator and counts the allocations made from one thread, so the task graph
+	// and the other threads allocating in the background aren't charged to the benchmark. Optionally only the ones
+	// made inside toolbox scopes, so the engine work of a world tick isn't either
+	class FThreadAllocationCounter final : public FMalloc
+	{
+	public:
+		void Install(uint32 InThreadId, bool bInToolboxOnly)
+		{
+			check(GMalloc != this);
+			Inner = GMalloc;
+			ThreadId = InThreadId;
+			bToolboxOnly = bInToolboxOnly;
+			NumAllocations = 0;
+			GMalloc = this;
+		}
+
+		// Threads that read GMalloc while it was installed can still call in afterwards, they keep being forwarded to Inner
+		void Uninstall()
+		{
+			GMalloc = Inner;
+			ThreadId = 0;
+		}
+
+		uint64 GetNumAllocations() const { return NumAllocations; }
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return Inner->Malloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			// A realloc to zero is a free
+			if (Count > 0)
+			{
+				CountAllocation();
+			}
+			return Inner->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override { Inner->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual const TCHAR* GetDescriptiveName() override { return TEXT("JesterThreadAllocationCounter"); }
+
+	private:
+		void CountAllocation()
+		{
+			if (FPlatformTLS::GetCurrentThreadId() == ThreadId && (!bToolboxOnly || JesterMemory::IsInToolboxScope()))
+			{
+				++NumAllocations;
+			}
+		}
+
+		FMalloc* Inner = nullptr;
+		uint32 ThreadId = 0;
+		bool bToolboxOnly = false;
+		uint64 NumAllocations = 0;
+	};
+
+	bool CanCountAllocations()
+	{
+		// FMemory calls the allocator class directly when it's fixed, a wrapper installed in GMalloc wouldn't see anything
+		return !PLATFORM_USES_FIXED_GMalloc_CLASS;
+	}
+
+	// Median of the per sample allocation counts of the benchmark thread
+	double MeasureAllocationsPerCall(FJesterBenchmark& Benchmark, int32 NumSamples)
+	{
+		// Static so it outlives the threads that may still be calling it after Uninstall
+		static FThreadAllocationCounter Counter;
+
+		TArray<uint64> AllocationsPerSample;
+		AllocationsPerSample.Reserve(NumSamples);
+		Counter.Install(FPlatformTLS::GetCurrentThreadId(), Benchmark.CountsToolboxAllocationsOnly());
+		for (int32 i = 0; i < NumSamples; ++i)
+		{
+			const uint64 StartAllocations = Counter.GetNumAllocations();
+			Benchmark.RunSample();
+			AllocationsPerSample.Add(Counter.GetNumAllocations() - StartAllocations);
+		}
+		Counter.Uninstall();
+
+		AllocationsPerSample.Sort();
+		return static_cast<double>(AllocationsPerSample[AllocationsPerSample.Num() / 2]) / FMath::Max(Benchmark.GetCallsPerSample(), 1);
+	}
+
+	TSharedRef<FJsonObject> MakeBuildJson()
+	{
+		TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+		Json->SetStringField(TEXT("EngineVersion"), FEngineVersion::Current().ToString());
+		Json->SetStringField(TEXT("BuildVersion"), FApp::GetBuildVersion());
+		Json->SetStringField(TEXT("Configuration"), LexToString(FApp::GetBuildConfiguration()));
+		Json->SetStringField(TEXT("Platform"), FPlatformProperties::IniPlatformName());
+		Json->SetStringField(TEXT("CPU"), FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+		Json->SetStringField(TEXT("Timestamp"), FDateTime::UtcNow().ToIso8601());
+		return Json;
+	}
+}
+
+UJesterBenchmarkCommandlet::UJesterBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UJesterBenchmarkCommandlet::Main(const FString& Params)
+{
+	FString Filter;
+	FParse::Value(*Params, TEXT("Filter="), Filter);
+
+	int32 NumSamples = 200;
+	FParse::Value(*Params, TEXT("Samples="), NumSamples);
+	NumSamples = FMath::Max(NumSamples, 1);
+
+	int32 NumWarmupSamples = 20;
+	FParse::Value(*Params, TEXT("Warmup="), NumWarmupSamples);
+
+	// Fail the run when a benchmark allocates more than its declared budget in steady state
+	const bool bCheckAllocations = FParse::Param(*Params, TEXT("CheckAllocations"));
+	if (bCheckAllocations && !CanCountAllocations())
+	{
+		UE_LOG(LogJesterBenchmarks, Error, TEXT("-CheckAllocations can't count allocations on a platform with a fixed GMalloc class"));
+		return 1;
+	}
+
+	FString OutputPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks") / FString::Printf(TEXT("JesterToolbox-%s.json"), *FDateTime::Now().ToString());
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	TArray<TUniquePtr<FJesterBenchmark>> Benchmarks;
+	JesterBenchmarks::GatherNativeBenchmarks(Benchmarks);
+	GatherScriptBenchmarks(Benchmarks);
+
+	UWorld* World = CreateBenchmarkWorld();
+
+	TArray<TSharedPtr<FJsonValue>> ResultsJson;
+	TArray<FString> SkippedBenchmarks;
+	TArray<FString> AllocationFailures;
+	for (const TUniquePtr<FJesterBenchmark>& Benchmark : Benchmarks)
+	{
+		if (!Filter.IsEmpty() && !Benchmark->GetName().Contains(Filter))
+		{
+			continue;
+		}
+
+		if (!Benchmark->Setup(World))
+		{
+			SkippedBenchmarks.Add(Benchmark->GetName());
+			Benchmark->Teardown();
+			continue;
+		}
+
+		for (int32 i = 0; i < NumWarmupSamples; ++i)
+		{
+			Benchmark->RunSample();
+		}
+
+		FJesterBenchmarkResult Result(Benchmark->GetName(), Benchmark->GetCallsPerSample());
+		for (int32 i = 0; i < NumSamples; ++i)
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			Benchmark->RunSample();
+			Result.AddSample(FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles));
+		}
+
+		if (CanCountAllocations())
+		{
+			Result.AllocationsPerCall = MeasureAllocationsPerCall(*Benchmark, FMath::Min(NumSamples, 50));
+			Result.AllocationBudget = Benchmark->GetAllocationBudget();
+			Result.bToolboxAllocationsOnly = Benchmark->CountsToolboxAllocationsOnly();
+			if (bCheckAllocations && Result.AllocationBudget == INDEX_NONE)
+			{
+				UE_LOG(LogJesterBenchmarks, Error, TEXT("%s has no allocation budget"), *Result.Name);
+				AllocationFailures.Add(Result.Name);
+			}
+			else if (Result.IsOverAllocationBudget())
+			{
+				UE_LOG(LogJesterBenchmarks, Error, TEXT("%s allocates %.2f times per call, budget is %d"), *Result.Name, Result.AllocationsPerCall, Result.AllocationBudget);
+				AllocationFailures.Add(Result.Name);
+			}
+		}
+
+		Benchmark->Teardown();
+		// Don't let garbage from one benchmark be collected in the middle of the next one
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+		UE_LOG(LogJesterBenchmarks, Display, TEXT("%-60s p50 %10.1f ns  p90 %10.1f ns  p99 %10.1f ns"),
+			*Result.Name, Result.GetPercentile(50.0) * 1e9, Result.GetPercentile(90.0) * 1e9, Result.GetPercentile(99.0) * 1e9);
+		ResultsJson.Add(MakeShared<FJsonValueObject>(Result.ToJson()));
+	}
+
+	DestroyBenchmarkWorld(World);
+
+	TArray<TSharedPtr<FJsonValue>> SkippedJson;
+	for (const FString& Skipped : SkippedBenchmarks)
+	{
+		UE_LOG(LogJesterBenchmarks, Warning, TEXT("Skipped %s"), *Skipped);
+		SkippedJson.Add(MakeShared<FJsonValueString>(Skipped));
+	}
+
+	TSharedRef<FJsonObject> RootJson = MakeShared<FJsonObject>();
+	RootJson->SetObjectField(TEXT("Build"), MakeBuildJson());
+	RootJson->SetNumberField(TEXT("SamplesPerBenchmark"), NumSamples);
+	RootJson->SetArrayField(TEXT("Benchmarks"), ResultsJson);
+	RootJson->SetArrayField(TEXT("Skipped"), SkippedJson);
+
+	TArray<TSharedPtr<FJsonValue>> AllocationFailuresJson;
+	for (const FString& Failure : AllocationFailures)
+	{
+		AllocationFailuresJson.Add(MakeShared<FJsonValueString>(Failure));
+	}
+	RootJson->SetArrayField(TEXT("AllocationFailures"), AllocationFailuresJson);
+
+	FString OutputJson;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputJson);
+	FJsonSerializer::Serialize(RootJson, Writer);
+	if (!FFileHelper::SaveStringToFile(OutputJson, *OutputPath))
+	{
+		UE_LOG(LogJesterBenchmarks, Error, TEXT("Could not write benchmark results to %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogJesterBenchmarks, Display, TEXT("Wrote %d benchmark results to %s"), ResultsJson.Num(), *OutputPath);
+	if (bCheckAllocations && AllocationFailures.Num() > 0)
+	{
+		UE_LOG(LogJesterBenchmarks, Error, TEXT("%d benchmarks went over their allocation budget"), AllocationFailures.Num());
+		return 1;
+	}
+	return 0;
+}
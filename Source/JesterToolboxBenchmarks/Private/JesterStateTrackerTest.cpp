@@ -0,0 +1,199 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "JesterTestStateTracker.h"
+
+TArray<FGameplayTag> UJesterTestStateTrackerComponent::TestStates;
+
+#if WITH_EDITOR && WITH_DEV_AUTOMATION_TESTS
+
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameplayTagsManager.h"
+#include "Misc/AutomationTest.h"
+#include "Settings/LevelEditorPlaySettings.h"
+
+namespace
+{
+	constexpr double StepTimeoutSeconds = 30.0;
+
+	struct FStateTrackerTestContext
+	{
+		FAutomationTestBase* Test = nullptr;
+		TWeakObjectPtr<UWorld> ServerWorld;
+		TWeakObjectPtr<UWorld> ClientWorld;
+		TWeakObjectPtr<AJesterTestStateTrackerActor> ServerActor;
+		TWeakObjectPtr<AJesterTestStateTrackerActor> ClientActor;
+		double StepStartTime = 0.0;
+		bool bFailed = false;
+	};
+
+	UWorld* FindPlayWorld(ENetMode NetMode)
+	{
+		for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+		{
+			UWorld* World = WorldContext.World();
+			if (WorldContext.WorldType == EWorldType::PIE && World != nullptr && World->GetNetMode() == NetMode)
+			{
+				return World;
+			}
+		}
+		return nullptr;
+	}
+
+	// Runs Step every frame until it returns true, the test fails if it takes longer than StepTimeoutSeconds
+	void AddWaitStep(const TSharedRef<FStateTrackerTestContext>& Context, const TCHAR* Description, TFunction<bool()>&& Step)
+	{
+		ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([Context, Description, Step = MoveTemp(Step)]()
+		{
+			if (Context->bFailed)
+			{
+				return true;
+			}
+
+			if (Context->StepStartTime == 0.0)
+			{
+				Context->StepStartTime = FPlatformTime::Seconds();
+			}
+			const bool bTimedOut = FPlatformTime::Seconds() - Context->StepStartTime > StepTimeoutSeconds;
+			if (Step() || bTimedOut)
+			{
+				if (bTimedOut)
+				{
+					Context->Test->AddError(FString::Printf(TEXT("Timed out waiting for %s"), Description));
+					Context->bFailed = true;
+				}
+				Context->StepStartTime = 0.0;
+				return true;
+			}
+			return false;
+		}));
+	}
+
+	// Runs Step once, skipped after a failure
+	void AddStep(const TSharedRef<FStateTrackerTestContext>& Context, TFunction<void()>&& Step)
+	{
+		ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([Context, Step = MoveTemp(Step)]()
+		{
+			if (!Context->bFailed)
+			{
+				Step();
+			}
+			return true;
+		}));
+	}
+}
+
+/**
+ * Listen server and one client in the editor process: a state set before BeginPlay reaches the client, a state the
+ * client predicted isn't reported again when the server confirms it
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJesterStateTrackerReplicationTest, "JesterToolbox.StateTracker.ListenServerReplication",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FJesterStateTrackerReplicationTest::RunTest(const FString& Parameters)
+{
+	FGameplayTagContainer AllTags;
+	UGameplayTagsManager::Get().RequestAllGameplayTags(AllTags, false);
+	TArray<FGameplayTag> Tags;
+	AllTags.GetGameplayTagArray(Tags);
+	if (Tags.Num() < 3)
+	{
+		AddError(TEXT("The project needs at least 3 gameplay tags to run this test"));
+		return false;
+	}
+	Tags.SetNum(3);
+	UJesterTestStateTrackerComponent::TestStates = Tags;
+	const FGameplayTag ServerState = Tags[0];
+	const FGameplayTag PredictedState = Tags[1];
+	const FGameplayTag MarkerState = Tags[2];
+
+	TSharedRef<FStateTrackerTestContext> Context = MakeShared<FStateTrackerTestContext>();
+	Context->Test = this;
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([]()
+	{
+		ULevelEditorPlaySettings* PlaySettings = NewObject<ULevelEditorPlaySettings>();
+		PlaySettings->SetPlayNetMode(EPlayNetMode::PIE_ListenServer);
+		// The listen server counts as the first client
+		PlaySettings->SetPlayNumberOfClients(2);
+		PlaySettings->bLaunchSeparateServer = false;
+		PlaySettings->SetRunUnderOneProcess(true);
+
+		FRequestPlaySessionParams Params;
+		Params.EditorPlaySettings = PlaySettings;
+		Params.SessionDestination = EPlaySessionDestinationType::InProcess;
+		GEditor->RequestPlaySession(Params);
+		return true;
+	}));
+
+	AddWaitStep(Context, TEXT("the listen server and its client"), [Context]()
+	{
+		Context->ServerWorld = FindPlayWorld(NM_ListenServer);
+		Context->ClientWorld = FindPlayWorld(NM_Client);
+		return Context->ServerWorld.IsValid() && Context->ClientWorld.IsValid() && Context->ClientWorld->GetFirstPlayerController() != nullptr;
+	});
+
+	AddStep(Context, [Context, ServerState]()
+	{
+		// Deferred so the state is set before BeginPlay, the tracker has to build its index on demand
+		AJesterTestStateTrackerActor* Actor = Context->ServerWorld->SpawnActorDeferred<AJesterTestStateTrackerActor>(
+			AJesterTestStateTrackerActor::StaticClass(), FTransform::Identity);
+		Actor->StateTracker->SetStateReplicated(ServerState, true);
+		Actor->FinishSpawning(FTransform::Identity);
+		Context->ServerActor = Actor;
+	});
+
+	AddWaitStep(Context, TEXT("the client to receive the state set before BeginPlay"), [Context]()
+	{
+		if (!Context->ClientActor.IsValid() && Context->ClientWorld.IsValid())
+		{
+			for (TActorIterator<AJesterTestStateTrackerActor> It(Context->ClientWorld.Get()); It; ++It)
+			{
+				Context->ClientActor = *It;
+			}
+		}
+		return Context->ClientActor.IsValid() && Context->ClientActor->StateTracker->ReceivedChanges.Num() > 0;
+	});
+
+	AddStep(Context, [Context, ServerState, PredictedState, MarkerState]()
+	{
+		const TArray<TPair<FGameplayTag, bool>>& ReceivedChanges = Context->ClientActor->StateTracker->ReceivedChanges;
+		Context->Test->TestEqual(TEXT("Changes received after spawning"), ReceivedChanges.Num(), 1);
+		Context->Test->TestTrue(TEXT("State set before BeginPlay replicated"), ReceivedChanges[0] == TPair<FGameplayTag, bool>(ServerState, true));
+
+		Context->ClientActor->StateTracker->SetStateReplicated(PredictedState, true);
+		Context->ServerActor->StateTracker->SetStateReplicated(PredictedState, true);
+		// Sent in the same update, once it's there the confirmation of the predicted state is too
+		Context->ServerActor->StateTracker->SetStateReplicated(MarkerState, true);
+	});
+
+	AddWaitStep(Context, TEXT("the client to receive the marker state"), [Context, MarkerState]()
+	{
+		return Context->ClientActor.IsValid() && Context->ClientActor->StateTracker->ReceivedChanges.ContainsByPredicate(
+			[MarkerState](const TPair<FGameplayTag, bool>& Change) { return Change.Key == MarkerState; });
+	});
+
+	AddStep(Context, [Context, PredictedState]()
+	{
+		const TArray<TPair<FGameplayTag, bool>>& ReceivedChanges = Context->ClientActor->StateTracker->ReceivedChanges;
+		Context->Test->TestEqual(TEXT("Changes received after the server confirmed the predicted state"), ReceivedChanges.Num(), 2);
+		Context->Test->TestFalse(TEXT("Predicted state reported again"), ReceivedChanges.ContainsByPredicate(
+			[PredictedState](const TPair<FGameplayTag, bool>& Change) { return Change.Key == PredictedState; }));
+	});
+
+	// Always end the session, even after a failure
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([]()
+	{
+		GEditor->RequestEndPlayMap();
+		return true;
+	}));
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([]()
+	{
+		return GEditor->PlayWorld == nullptr;
+	}));
+	return true;
+}
+
+#endif
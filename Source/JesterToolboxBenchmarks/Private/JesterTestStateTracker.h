@@ -0,0 +1,51 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/JesterStateTrackerComponent.h"
+#include "GameFramework/Actor.h"
+#include "JesterTestStateTracker.generated.h"
+
+/**
+ * State tracker filled from code for the replication test, records every change the server sent
+ */
+UCLASS(Transient, NotBlueprintable)
+class UJesterTestStateTrackerComponent : public UJesterStateTrackerComponent
+{
+	GENERATED_BODY()
+
+public:
+	// Shared by the server and client instances so they build the same index
+	static TArray<FGameplayTag> TestStates;
+
+	TArray<TPair<FGameplayTag, bool>> ReceivedChanges;
+
+protected:
+	virtual TArray<FGameplayTag> GetTrackedStates_Implementation() const override
+	{
+		return TestStates;
+	}
+
+	virtual void OnReplicatedStateChanged_Implementation(FGameplayTag StateTag, bool bAdded) override
+	{
+		ReceivedChanges.Emplace(StateTag, bAdded);
+	}
+};
+
+UCLASS(Transient, NotBlueprintable)
+class AJesterTestStateTrackerActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AJesterTestStateTrackerActor()
+	{
+		bReplicates = true;
+		bAlwaysRelevant = true;
+		StateTracker = CreateDefaultSubobject<UJesterTestStateTrackerComponent>(TEXT("StateTracker"));
+	}
+
+	UPROPERTY()
+	UJesterTestStateTrackerComponent* StateTracker;
+};
@@ -0,0 +1,19 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "JesterToolboxBenchmarks.h"
+
+DEFINE_LOG_CATEGORY(LogJesterBenchmarks);
+
+#define LOCTEXT_NAMESPACE "FJesterToolboxBenchmarksModule"
+
+void FJesterToolboxBenchmarksModule::StartupModule()
+{
+}
+
+void FJesterToolboxBenchmarksModule::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+
+IMPLEMENT_MODULE(FJesterToolboxBenchmarksModule, JesterToolboxBenchmarks)
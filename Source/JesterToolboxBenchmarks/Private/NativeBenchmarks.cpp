@@ -0,0 +1,377 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "NativeBenchmarks.h"
+
+#include "BenchmarkAssetsLocatorService.h"
+#include "GameplayTagsManager.h"
+#include "JesterBenchmark.h"
+#include "JesterToolboxBenchmarks.h"
+#include "Core/JesterFunctionLibrary.h"
+#include "Core/ManagerActor.h"
+#include "Core/ManagerLocatorSubsystem.h"
+#include "Curves/CurveFloat.h"
+#include "Engine/World.h"
+#include "Utils/ScalableMultiChannelCurve.h"
+#include "Utils/ScalableRuntimeCurve.h"
+
+namespace
+{
+	// Keeps the optimizer from discarding the measured calls, reading through volatile forces the result to exist
+	volatile uint64 GBenchmarkSink = 0;
+
+	template<typename T>
+	void Consume(const T& Value)
+	{
+		GBenchmarkSink += *reinterpret_cast<const volatile uint8*>(&Value);
+	}
+
+	TArray<FGameplayTag> GetProjectTags(int32 MaxTags)
+	{
+		FGameplayTagContainer AllTags;
+		UGameplayTagsManager::Get().RequestAllGameplayTags(AllTags, false);
+
+		TArray<FGameplayTag> Tags;
+		AllTags.GetGameplayTagArray(Tags);
+		if (Tags.Num() > MaxTags)
+		{
+			Tags.SetNum(MaxTags);
+		}
+		return Tags;
+	}
+
+	/**
+	 * The locator only accepts one manager per class, so every benchmark manager needs its own class.
+	 * Creates (or reuses) a transient subclass of AManagerActor.
+	 */
+	UClass* GetOrCreateManagerClass(int32 Index)
+	{
+		const FString ClassName = FString::Printf(TEXT("JesterBenchmarkManager_%d"), Index);
+		if (UClass* ExistingClass = FindObject<UClass>(GetTransientPackage(), *ClassName))
+		{
+			return ExistingClass;
+		}
+
+		UClass* ParentClass = AManagerActor::StaticClass();
+		UClass* NewClass = NewObject<UClass>(GetTransientPackage(), *ClassName, RF_Public | RF_Transient);
+		NewClass->SetSuperStruct(ParentClass);
+		NewClass->ClassFlags |= (ParentClass->ClassFlags & CLASS_Inherit) | CLASS_Transient;
+		NewClass->ClassCastFlags |= ParentClass->ClassCastFlags;
+		NewClass->ClassWithin = ParentClass->ClassWithin;
+		NewClass->ClassConfigName = ParentClass->ClassConfigName;
+		NewClass->Bind();
+		NewClass->StaticLink(true);
+		NewClass->AssembleReferenceTokenStream();
+		NewClass->GetDefaultObject();
+		return NewClass;
+	}
+
+	class FManagerLookupBenchmark : public FJesterBenchmark
+	{
+	public:
+		FManagerLookupBenchmark(int32 InNumManagers, bool bInLookupLast)
+			: FJesterBenchmark(FString::Printf(TEXT("ManagerLocator.GetManager.%s.%d"), bInLookupLast ? TEXT("Last") : TEXT("First"), InNumManagers), 1000, 0)
+			, NumManagers(InNumManagers)
+			, bLookupLast(bInLookupLast)
+		{
+		}
+
+		virtual bool Setup(UWorld* World) override
+		{
+			Locator = UJesterFunctionLibrary::GetManagerLocator();
+			if (Locator == nullptr)
+			{
+				return false;
+			}
+
+			for (int32 i = 0; i < NumManagers; ++i)
+			{
+				UClass* ManagerClass = GetOrCreateManagerClass(i);
+				// Managers register themselves in BeginPlay
+				Managers.Add(World->SpawnActor<AActor>(ManagerClass));
+			}
+
+			LookupClass = GetOrCreateManagerClass(bLookupLast ? NumManagers - 1 : 0);
+			return Locator->GetManager(LookupClass) != nullptr;
+		}
+
+		virtual void RunSample() override
+		{
+			for (int32 i = 0; i < CallsPerSample; ++i)
+			{
+				Consume(Locator->GetManager(LookupClass));
+			}
+		}
+
+		virtual void Teardown() override
+		{
+			for (AActor* Manager : Managers)
+			{
+				if (IsValid(Manager))
+				{
+					Manager->Destroy();
+				}
+			}
+			Managers.Empty();
+		}
+
+	private:
+		int32 NumManagers = 0;
+		bool bLookupLast = false;
+		UManagerLocatorSubsystem* Locator = nullptr;
+		UClass* LookupClass = nullptr;
+		TArray<AActor*> Managers;
+	};
+
+	class FAssetLocatorBenchmark : public FJesterBenchmark
+	{
+	public:
+		FAssetLocatorBenchmark(bool bInLookupClasses)
+			: FJesterBenchmark(bInLookupClasses ? TEXT("AssetsLocator.GetAssetClass") : TEXT("AssetsLocator.GetAsset"), 1000, 0)
+			, bLookupClasses(bInLookupClasses)
+		{
+		}
+
+		virtual bool Setup(UWorld* World) override
+		{
+			Tags = GetProjectTags(1000);
+			if (Tags.IsEmpty())
+			{
+				UE_LOG(LogJesterBenchmarks, Warning, TEXT("%s skipped, the project has no gameplay tags"), *Name);
+				return false;
+			}
+
+			for (int32 i = 0; i < 16; ++i)
+			{
+				Assets.Add(NewObject<UCurveFloat>(GetTransientPackage()));
+				Assets.Last()->AddToRoot();
+			}
+
+			Locator = NewObject<UBenchmarkAssetsLocatorService>(GetTransientPackage());
+			Locator->AddToRoot();
+			Locator->Populate(Tags, Assets, 8);
+			Locator->Initialize();
+			return true;
+		}
+
+		virtual void RunSample() override
+		{
+			for (int32 i = 0; i < CallsPerSample; ++i)
+			{
+				const FGameplayTag& Tag = Tags[i % Tags.Num()];
+				if (bLookupClasses)
+				{
+					Consume(Locator->GetAssetClass(Tag, UCurveFloat::StaticClass()).Get());
+				}
+				else
+				{
+					Consume(Locator->GetAsset(Tag, UCurveFloat::StaticClass()));
+				}
+			}
+		}
+
+		virtual void Teardown() override
+		{
+			for (UObject* Asset : Assets)
+			{
+				Asset->RemoveFromRoot();
+			}
+			Assets.Empty();
+			Locator->RemoveFromRoot();
+			Locator = nullptr;
+		}
+
+	private:
+		bool bLookupClasses = false;
+		TArray<FGameplayTag> Tags;
+		TArray<UObject*> Assets;
+		UBenchmarkAssetsLocatorService* Locator = nullptr;
+	};
+
+	class FScalableCurveBenchmark : public FJesterBenchmark
+	{
+	public:
+		FScalableCurveBenchmark(int32 InNumKeys)
+			: FJesterBenchmark(FString::Printf(TEXT("Curves.ScalableRuntimeCurve.Evaluate.%dKeys"), InNumKeys), 1000, 0)
+			, NumKeys(InNumKeys)
+		{
+		}
+
+		virtual bool Setup(UWorld* World) override
+		{
+			for (int32 i = 0; i < NumKeys; ++i)
+			{
+				const float Time = static_cast<float>(i) / FMath::Max(NumKeys - 1, 1);
+				Curve.AddKeyOrSetNormalized(Time, FMath::Sin(Time * PI));
+			}
+			Curve.ScaleX = 2.0f;
+			Curve.ScaleY = 10.0f;
+			return true;
+		}
+
+		virtual void RunSample() override
+		{
+			for (int32 i = 0; i < CallsPerSample; ++i)
+			{
+				Consume(Curve.Evaluate(2.0f * i / CallsPerSample));
+			}
+		}
+
+	private:
+		int32 NumKeys = 0;
+		FScalableRuntimeCurve Curve;
+	};
+
+	class FMultiChannelCurveBenchmark : public FJesterBenchmark
+	{
+	public:
+		FMultiChannelCurveBenchmark(int32 InNumKeys, bool bInBatch)
+			: FJesterBenchmark(FString::Printf(TEXT("Curves.ScalableMultiChannelCurve.%s.%dKeys"), bInBatch ? TEXT("EvaluateBatch") : TEXT("Evaluate"), InNumKeys), 1000, 0)
+			, NumKeys(InNumKeys)
+			, bBatch(bInBatch)
+		{
+		}
+
+		virtual bool Setup(UWorld* World) override
+		{
+			for (int32 i = 0; i < NumKeys; ++i)
+			{
+				const float Time = static_cast<float>(i) / FMath::Max(NumKeys - 1, 1);
+				Curve.AddKeyOrSetNormalized(Time, FVector4f(FMath::Sin(Time * PI), FMath::Cos(Time * PI), Time, 1.0f));
+			}
+			Curve.ScaleX = 2.0f;
+			Curve.ChannelScales = FVector4f(10.0f, 10.0f, 10.0f, 1.0f);
+
+			Times.SetNumUninitialized(CallsPerSample);
+			for (int32 i = 0; i < CallsPerSample; ++i)
+			{
+				Times[i] = 2.0f * i / CallsPerSample;
+			}
+			Values.SetNumUninitialized(CallsPerSample);
+			return true;
+		}
+
+		virtual void RunSample() override
+		{
+			if (bBatch)
+			{
+				Curve.EvaluateBatch(Times, Values);
+				Consume(Values.Last());
+				return;
+			}
+
+			for (int32 i = 0; i < CallsPerSample; ++i)
+			{
+				Consume(Curve.Evaluate(Times[i]));
+			}
+		}
+
+	private:
+		int32 NumKeys = 0;
+		bool bBatch = false;
+		FScalableMultiChannelCurve Curve;
+		TArray<float> Times;
+		TArray<FVector4f> Values;
+	};
+
+	class FTagHelpersBenchmark : public FJesterBenchmark
+	{
+	public:
+		enum class EHelper : uint8
+		{
+			GetLeafTag,
+			GetParentsTag,
+			GetTagNodes,
+			GetAllChildTags
+		};
+
+		// The helpers return new strings and containers, the budget is what they allocate today so regressions show up
+		FTagHelpersBenchmark(EHelper InHelper, const TCHAR* HelperName)
+			: FJesterBenchmark(FString::Printf(TEXT("Tags.%s"), HelperName), 100, InHelper == EHelper::GetAllChildTags ? 16 : 4)
+			, Helper(InHelper)
+		{
+		}
+
+		virtual bool Setup(UWorld* World) override
+		{
+			Tags = GetProjectTags(256);
+			if (Tags.IsEmpty())
+			{
+				UE_LOG(LogJesterBenchmarks, Warning, TEXT("%s skipped, the project has no gameplay tags"), *Name);
+				return false;
+			}
+			Container = FGameplayTagContainer::CreateFromArray(Tags);
+			return true;
+		}
+
+		virtual void RunSample() override
+		{
+			for (int32 i = 0; i < CallsPerSample; ++i)
+			{
+				const FGameplayTag& Tag = Tags[i % Tags.Num()];
+				switch (Helper)
+				{
+				case EHelper::GetLeafTag:
+					Consume(UJesterFunctionLibrary::GetLeafTag(Tag));
+					break;
+				case EHelper::GetParentsTag:
+					Consume(UJesterFunctionLibrary::GetParentsTag(Tag));
+					break;
+				case EHelper::GetTagNodes:
+					Consume(UJesterFunctionLibrary::GetTagNodes(Container, Tag.RequestDirectParent()));
+					break;
+				case EHelper::GetAllChildTags:
+					Consume(UJesterFunctionLibrary::GetAllChildTags(Tag.RequestDirectParent(), 3));
+					break;
+				}
+			}
+		}
+
+	private:
+		EHelper Helper;
+		TArray<FGameplayTag> Tags;
+		FGameplayTagContainer Container;
+	};
+
+	class FTimeDurationToTextBenchmark : public FJesterBenchmark
+	{
+	public:
+		FTimeDurationToTextBenchmark()
+			: FJesterBenchmark(TEXT("FunctionLibrary.TimeDurationToText"), 100, 4)
+		{
+		}
+
+		virtual void RunSample() override
+		{
+			for (int32 i = 0; i < CallsPerSample; ++i)
+			{
+				Consume(UJesterFunctionLibrary::TimeDurationToText(i * 37.5f));
+			}
+		}
+	};
+}
+
+void JesterBenchmarks::GatherNativeBenchmarks(TArray<TUniquePtr<FJesterBenchmark>>& OutBenchmarks)
+{
+	for (const int32 NumManagers : { 10, 100, 1000 })
+	{
+		OutBenchmarks.Add(MakeUnique<FManagerLookupBenchmark>(NumManagers, false));
+		OutBenchmarks.Add(MakeUnique<FManagerLookupBenchmark>(NumManagers, true));
+	}
+
+	OutBenchmarks.Add(MakeUnique<FAssetLocatorBenchmark>(false));
+	OutBenchmarks.Add(MakeUnique<FAssetLocatorBenchmark>(true));
+
+	for (const int32 NumKeys : { 4, 32, 256 })
+	{
+		OutBenchmarks.Add(MakeUnique<FScalableCurveBenchmark>(NumKeys));
+		OutBenchmarks.Add(MakeUnique<FMultiChannelCurveBenchmark>(NumKeys, false));
+		OutBenchmarks.Add(MakeUnique<FMultiChannelCurveBenchmark>(NumKeys, true));
+	}
+
+	OutBenchmarks.Add(MakeUnique<FTagHelpersBenchmark>(FTagHelpersBenchmark::EHelper::GetLeafTag, TEXT("GetLeafTag")));
+	OutBenchmarks.Add(MakeUnique<FTagHelpersBenchmark>(FTagHelpersBenchmark::EHelper::GetParentsTag, TEXT("GetParentsTag")));
+	OutBenchmarks.Add(MakeUnique<FTagHelpersBenchmark>(FTagHelpersBenchmark::EHelper::GetTagNodes, TEXT("GetTagNodes")));
+	OutBenchmarks.Add(MakeUnique<FTagHelpersBenchmark>(FTagHelpersBenchmark::EHelper::GetAllChildTags, TEXT("GetAllChildTags")));
+
+	OutBenchmarks.Add(MakeUnique<FTimeDurationToTextBenchmark>());
+}
@@ -0,0 +1,13 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJesterBenchmark;
+
+namespace JesterBenchmarks
+{
+	// Adds every C++ benchmark of the toolbox to OutBenchmarks
+	void GatherNativeBenchmarks(TArray<TUniquePtr<FJesterBenchmark>>& OutBenchmarks);
+}
@@ -0,0 +1,122 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "JesterBenchmark.generated.h"
+
+class FJsonObject;
+
+/**
+ * Timing samples collected for a single benchmark. Each sample is stored as seconds per call so benchmarks that
+ * batch several calls per sample can still be compared with each other.
+ */
+struct JESTERTOOLBOXBENCHMARKS_API FJesterBenchmarkResult
+{
+	FString Name;
+	int32 CallsPerSample = 1;
+	TArray<double> SecondsPerCall;
+
+	// Median heap allocations per call once warmed up, INDEX_NONE when allocations weren't measured
+	double AllocationsPerCall = INDEX_NONE;
+	int32 AllocationBudget = INDEX_NONE;
+	// Only allocations made inside JesterMemory::FToolboxScope were counted
+	bool bToolboxAllocationsOnly = false;
+
+	FJesterBenchmarkResult() = default;
+	FJesterBenchmarkResult(const FString& InName, int32 InCallsPerSample)
+		: Name(InName), CallsPerSample(FMath::Max(InCallsPerSample, 1))
+	{
+	}
+
+	void AddSample(double TotalSeconds)
+	{
+		SecondsPerCall.Add(TotalSeconds / CallsPerSample);
+	}
+
+	// Nearest-rank percentile, Percentile is in [0, 100]
+	double GetPercentile(double Percentile) const;
+	double GetMean() const;
+
+	bool IsOverAllocationBudget() const
+	{
+		return AllocationBudget != INDEX_NONE && AllocationsPerCall > AllocationBudget;
+	}
+
+	TSharedRef<FJsonObject> ToJson() const;
+};
+
+/**
+ * Native benchmark run by the JesterBenchmark commandlet.
+ * Setup and Teardown run once, RunSample is timed and should perform CallsPerSample calls of the measured operation.
+ */
+class JESTERTOOLBOXBENCHMARKS_API FJesterBenchmark
+{
+public:
+	FJesterBenchmark(const FString& InName, int32 InCallsPerSample = 1, int32 InAllocationBudget = INDEX_NONE, bool bInToolboxAllocationsOnly = false)
+		: Name(InName), CallsPerSample(InCallsPerSample), AllocationBudget(InAllocationBudget), bToolboxAllocationsOnly(bInToolboxAllocationsOnly)
+	{
+	}
+	virtual ~FJesterBenchmark() = default;
+
+	// Returns false if the benchmark can't run in this project (missing tags, missing classes...)
+	virtual bool Setup(UWorld* World) { return true; }
+	virtual void RunSample() = 0;
+	virtual void Teardown() {}
+
+	const FString& GetName() const { return Name; }
+	int32 GetCallsPerSample() const { return CallsPerSample; }
+	int32 GetAllocationBudget() const { return AllocationBudget; }
+	bool CountsToolboxAllocationsOnly() const { return bToolboxAllocationsOnly; }
+
+protected:
+	FString Name;
+	int32 CallsPerSample = 1;
+	// Max heap allocations per call (per frame for world tick benchmarks) checked by -CheckAllocations, INDEX_NONE only reports them
+	int32 AllocationBudget = INDEX_NONE;
+	// Charge only the allocations made inside JesterMemory::FToolboxScope, for world tick benchmarks where the engine
+	// allocates around the toolbox code
+	bool bToolboxAllocationsOnly = false;
+};
+
+/**
+ * Base class for benchmarks written in script, picked up automatically by the JesterBenchmark commandlet.
+ * The object is outered to the benchmark world so script can spawn actors from Setup.
+ */
+UCLASS(Abstract, Blueprintable)
+class JESTERTOOLBOXBENCHMARKS_API UJesterScriptBenchmark : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditDefaultsOnly, Category = "Benchmark")
+	FString BenchmarkName;
+
+	// Number of calls RunSample performs, used to report the time of a single call
+	UPROPERTY(EditDefaultsOnly, Category = "Benchmark")
+	int32 CallsPerSample = 1;
+
+	// Macro benchmark: every sample ticks the benchmark world once instead of calling RunSample
+	UPROPERTY(EditDefaultsOnly, Category = "Benchmark")
+	bool bTickWorld = false;
+
+	// Max heap allocations per call checked by -CheckAllocations, -1 only reports them
+	UPROPERTY(EditDefaultsOnly, Category = "Benchmark")
+	int32 AllocationBudget = -1;
+
+	// Only count the allocations made inside the toolbox scopes (JesterMemory::EnterToolboxScope in script)
+	UPROPERTY(EditDefaultsOnly, Category = "Benchmark")
+	bool bToolboxAllocationsOnly = false;
+
+	UFUNCTION(BlueprintImplementableEvent, Category = "Benchmark")
+	void Setup();
+
+	UFUNCTION(BlueprintImplementableEvent, Category = "Benchmark")
+	void RunSample();
+
+	UFUNCTION(BlueprintImplementableEvent, Category = "Benchmark")
+	void Teardown();
+
+	virtual UWorld* GetWorld() const override;
+};
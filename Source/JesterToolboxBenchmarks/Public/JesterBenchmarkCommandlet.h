@@ -0,0 +1,28 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "JesterBenchmarkCommandlet.generated.h"
+
+/**
+ * Runs the toolbox benchmarks headless and writes the results as JSON.
+ *
+ * UnrealEditor-Cmd <Project>.uproject -run=JesterBenchmark -nullrhi -unattended
+ *		-Filter=<Substring>	Only run benchmarks whose name contains Substring
+ *		-Samples=<N>		Timed samples per benchmark (default 200)
+ *		-Warmup=<N>			Untimed samples run before measuring (default 20)
+ *		-Output=<Path>		Result file (default Saved/Benchmarks/JesterToolbox-<Timestamp>.json)
+ *		-CheckAllocations	Fail when a benchmark allocates more than its AllocationBudget once warmed up (not on platforms with a fixed GMalloc class)
+ */
+UCLASS()
+class JESTERTOOLBOXBENCHMARKS_API UJesterBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UJesterBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};